@@ -0,0 +1,55 @@
+#include <append_only_unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using log_type = append_only_unrolled_list<long long, 64>;
+
+std::unique_ptr<log_type> event_log;
+std::atomic<bool> appending = false;
+std::thread appender;
+
+void BM_AppendOnlyReaders(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        event_log = std::make_unique<log_type>();
+        for (long long i = 0; i < 100'000; ++i) {
+            event_log->push_back(i);
+        }
+        appending = true;
+        appender = std::thread([] {
+            long long i = 100'000;
+            while (appending.load(std::memory_order_relaxed) &&
+                   i < 20'000'000) {
+                event_log->push_back(i++);
+            }
+        });
+    }
+
+    long long scanned = 0;
+    for (auto _ : state) {
+        auto snapshot = event_log->read();
+        long long sum = 0;
+        size_t taken = 0;
+        for (long long value : snapshot) {
+            sum += value;
+            if (++taken == 100'000) break;
+        }
+        scanned += taken;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(scanned);
+
+    if (state.thread_index() == 0) {
+        appending = false;
+        appender.join();
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_AppendOnlyReaders)->ThreadRange(1, 8)->UseRealTime();
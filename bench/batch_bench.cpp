@@ -0,0 +1,133 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr size_t kElements = 1'000'000;
+constexpr size_t kNodeMaxSize = 64;
+using list_type = unrolled_list<int, kNodeMaxSize>;
+
+list_type MakeList() {
+    list_type list;
+    for (size_t i = 0; i < kElements; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+    return list;
+}
+
+std::vector<std::pair<size_t, int>> MakeBatch(size_t k) {
+    std::mt19937 gen(42);
+    std::vector<std::pair<size_t, int>> batch(k);
+    for (auto& [pos, value] : batch) {
+        pos = gen() % (kElements + 1);
+        value = -1;
+    }
+    std::sort(batch.begin(), batch.end());
+    return batch;
+}
+
+void BM_InsertOneByOne(benchmark::State& state) {
+    auto batch = MakeBatch(state.range(0));
+    list_type list;
+    for (auto _ : state) {
+        state.PauseTiming();
+        list = MakeList();
+        state.ResumeTiming();
+        auto it = list.begin();
+        size_t at = 0;
+        for (const auto& [pos, value] : batch) {
+            std::advance(it, pos - at);
+            at = pos;
+            it = list.insert(it, value);
+            ++it;
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+void BM_InsertBatch(benchmark::State& state) {
+    auto batch = MakeBatch(state.range(0));
+    list_type list;
+    for (auto _ : state) {
+        state.PauseTiming();
+        list = MakeList();
+        state.ResumeTiming();
+        list.insert_batch(batch.begin(), batch.end());
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_InsertOneByOne)
+    ->Arg(1000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InsertBatch)
+    ->Arg(1000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+std::vector<size_t> MakeIndices(size_t k) {
+    std::mt19937 gen(7);
+    std::vector<size_t> indices(k);
+    for (size_t& index : indices) {
+        index = gen() % kElements;
+    }
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    return indices;
+}
+
+void BM_EraseOneByOne(benchmark::State& state) {
+    auto indices = MakeIndices(state.range(0));
+    list_type list;
+    for (auto _ : state) {
+        state.PauseTiming();
+        list = MakeList();
+        state.ResumeTiming();
+        auto it = list.begin();
+        size_t at = 0;
+        for (size_t index : indices) {
+            std::advance(it, index - at);
+            it = list.erase(it);
+            at = index + 1;
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+void BM_EraseIndices(benchmark::State& state) {
+    auto indices = MakeIndices(state.range(0));
+    list_type list;
+    for (auto _ : state) {
+        state.PauseTiming();
+        list = MakeList();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(
+            list.erase_indices(indices.begin(), indices.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_EraseOneByOne)
+    ->Arg(1000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EraseIndices)
+    ->Arg(1000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,46 @@
+#include <bounded_unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+namespace {
+
+constexpr int kNodeBudget = 1024;
+constexpr int kNodeSize = 64;
+constexpr int kCapacity = kNodeBudget * kNodeSize;
+
+void BM_DequeRing(benchmark::State& state) {
+    std::deque<int> ring;
+    int value = 0;
+    for (auto _ : state) {
+        if (ring.size() == kCapacity) ring.pop_front();
+        ring.push_back(value++);
+    }
+    benchmark::DoNotOptimize(ring.back());
+}
+
+void BM_UnrolledListRing(benchmark::State& state) {
+    unrolled_list<int, kNodeSize> ring;
+    int value = 0;
+    for (auto _ : state) {
+        if (ring.size() == kCapacity) ring.pop_front();
+        ring.push_back(value++);
+    }
+    benchmark::DoNotOptimize(ring.back());
+}
+
+void BM_BoundedUnrolledList(benchmark::State& state) {
+    bounded_unrolled_list<int, kNodeSize> ring(kNodeBudget);
+    int value = 0;
+    for (auto _ : state) {
+        ring.push_back(value++);
+    }
+    benchmark::DoNotOptimize(ring.back());
+}
+
+}  // namespace
+
+BENCHMARK(BM_DequeRing);
+BENCHMARK(BM_UnrolledListRing);
+BENCHMARK(BM_BoundedUnrolledList);
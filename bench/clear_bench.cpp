@@ -0,0 +1,86 @@
+#include <node_arena.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace {
+
+constexpr size_t kElements = 10'000'000;
+constexpr size_t kNodeMaxSize = 64;
+
+template <typename List>
+void Fill(List& list) {
+    for (size_t i = 0; i < kElements; ++i) {
+        list.push_back(static_cast<typename List::value_type>(i));
+    }
+}
+
+void BM_ClearStdAllocator(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        unrolled_list<int, kNodeMaxSize> list;
+        Fill(list);
+        state.ResumeTiming();
+        list.clear();
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+
+void BM_ClearNodeArena(benchmark::State& state) {
+    using arena_type = node_arena<int, kNodeMaxSize>;
+    arena_type arena(1 << 14);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = arena.make_list();
+        Fill(list);
+        state.ResumeTiming();
+        list.clear();
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+
+void BM_ReleaseNodeArena(benchmark::State& state) {
+    using arena_type = node_arena<int, kNodeMaxSize>;
+    for (auto _ : state) {
+        state.PauseTiming();
+        arena_type arena(1 << 14);
+        auto list = arena.make_list();
+        Fill(list);
+        state.ResumeTiming();
+        arena.release();
+        list.abandon();
+        benchmark::DoNotOptimize(arena.slabs_allocated());
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ClearStdAllocator)->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_ClearNodeArena)->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_ReleaseNodeArena)->Unit(benchmark::kMicrosecond)->Iterations(5);
+
+namespace {
+
+template <bool KeepCapacity>
+void BM_ScratchRefill(benchmark::State& state) {
+    unrolled_list<int, kNodeMaxSize> list;
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.size());
+        if constexpr (KeepCapacity) {
+            list.reset();
+        } else {
+            list.clear();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScratchRefill<false>)->Arg(1024);
+BENCHMARK(BM_ScratchRefill<true>)->Arg(1024);
@@ -0,0 +1,77 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+namespace {
+
+constexpr size_t kNodeMaxSize = 256;
+using list_type = unrolled_list<int, kNodeMaxSize>;
+
+std::vector<int> MakeValues(size_t n) {
+    std::vector<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+void SetBytes(benchmark::State& state) {
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            sizeof(int));
+}
+
+void BM_ImportElementwise(benchmark::State& state) {
+    auto values = MakeValues(state.range(0));
+    for (auto _ : state) {
+        list_type list(values.begin(), values.end(),
+                       list_type::allocator_type());
+        benchmark::DoNotOptimize(list.size());
+    }
+    SetBytes(state);
+}
+
+void BM_ImportContiguous(benchmark::State& state) {
+    auto values = MakeValues(state.range(0));
+    for (auto _ : state) {
+        list_type list(values);
+        benchmark::DoNotOptimize(list.size());
+    }
+    SetBytes(state);
+}
+
+void BM_ExportElementwise(benchmark::State& state) {
+    list_type list(MakeValues(state.range(0)));
+    for (auto _ : state) {
+        std::vector<int> out(list.begin(), list.end());
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetBytes(state);
+}
+
+void BM_ExportToVector(benchmark::State& state) {
+    list_type list(MakeValues(state.range(0)));
+    for (auto _ : state) {
+        std::vector<int> out = list.to_vector();
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetBytes(state);
+}
+
+void BM_ExportCopyTo(benchmark::State& state) {
+    list_type list(MakeValues(state.range(0)));
+    std::vector<int> out(list.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.copy_to(out));
+        benchmark::ClobberMemory();
+    }
+    SetBytes(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ImportElementwise)->Arg(1 << 20);
+BENCHMARK(BM_ImportContiguous)->Arg(1 << 20);
+BENCHMARK(BM_ExportElementwise)->Arg(1 << 20);
+BENCHMARK(BM_ExportToVector)->Arg(1 << 20);
+BENCHMARK(BM_ExportCopyTo)->Arg(1 << 20);
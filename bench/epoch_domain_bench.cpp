@@ -0,0 +1,59 @@
+#include <epoch_domain.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Payload {
+    long long Value[8];
+};
+
+void BM_DeleteDirectly(benchmark::State& state) {
+    std::allocator<Payload> alloc;
+    for (auto _ : state) {
+        Payload* p = alloc.allocate(1);
+        benchmark::DoNotOptimize(p);
+        alloc.deallocate(p, 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RetireAndReclaim(benchmark::State& state) {
+    std::allocator<Payload> alloc;
+    epoch_domain domain(state.range(0));
+    std::vector<epoch_domain::participant> readers;
+    for (int i = 0; i < state.range(1); ++i) {
+        readers.push_back(domain.register_thread());
+    }
+    auto writer = domain.register_thread();
+    for (auto _ : state) {
+        Payload* p = alloc.allocate(1);
+        benchmark::DoNotOptimize(p);
+        writer.retire_allocated(alloc, p);
+    }
+    writer.reclaim();
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PinUnpin(benchmark::State& state) {
+    epoch_domain domain;
+    auto reader = domain.register_thread();
+    for (auto _ : state) {
+        auto guard = reader.pin();
+        benchmark::DoNotOptimize(&guard);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_DeleteDirectly);
+BENCHMARK(BM_RetireAndReclaim)
+    ->Args({16, 0})
+    ->Args({64, 0})
+    ->Args({256, 0})
+    ->Args({64, 16});
+BENCHMARK(BM_PinUnpin);
@@ -0,0 +1,94 @@
+#include <flat_unrolled_map.h>
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#if __has_include(<flat_map>)
+#include <flat_map>
+#endif
+#ifdef UNROLLED_LIST_HAVE_ABSL
+#include <absl/container/btree_map.h>
+#endif
+
+namespace {
+
+std::vector<int> RandomKeys(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<int> keys(n);
+    for (int& key : keys) {
+        key = static_cast<int>(gen());
+    }
+    return keys;
+}
+
+template <typename Map>
+void BM_MapInsert(benchmark::State& state) {
+    auto keys = RandomKeys(state.range(0));
+    for (auto _ : state) {
+        Map map;
+        for (int key : keys) {
+            map.try_emplace(key, key);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Map>
+void BM_MapFind(benchmark::State& state) {
+    auto keys = RandomKeys(state.range(0));
+    Map map;
+    for (int key : keys) {
+        map.try_emplace(key, key);
+    }
+    std::mt19937 gen(7);
+    for (auto _ : state) {
+        int key = keys[gen() % keys.size()];
+        benchmark::DoNotOptimize(map.find(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_MapIterate(benchmark::State& state) {
+    auto keys = RandomKeys(state.range(0));
+    Map map;
+    for (int key : keys) {
+        map.try_emplace(key, key);
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (const auto& [key, value] : map) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+using flat_map_type = flat_unrolled_map<int, int, 64>;
+using std_map_type = std::map<int, int>;
+
+}  // namespace
+
+BENCHMARK(BM_MapInsert<flat_map_type>)->Arg(1 << 16);
+BENCHMARK(BM_MapInsert<std_map_type>)->Arg(1 << 16);
+BENCHMARK(BM_MapFind<flat_map_type>)->Arg(1 << 16);
+BENCHMARK(BM_MapFind<std_map_type>)->Arg(1 << 16);
+BENCHMARK(BM_MapIterate<flat_map_type>)->Arg(1 << 16);
+BENCHMARK(BM_MapIterate<std_map_type>)->Arg(1 << 16);
+
+#if defined(__cpp_lib_flat_map)
+BENCHMARK(BM_MapInsert<std::flat_map<int, int>>)->Arg(1 << 16);
+BENCHMARK(BM_MapFind<std::flat_map<int, int>>)->Arg(1 << 16);
+BENCHMARK(BM_MapIterate<std::flat_map<int, int>>)->Arg(1 << 16);
+#endif
+
+#ifdef UNROLLED_LIST_HAVE_ABSL
+BENCHMARK(BM_MapInsert<absl::btree_map<int, int>>)->Arg(1 << 16);
+BENCHMARK(BM_MapFind<absl::btree_map<int, int>>)->Arg(1 << 16);
+BENCHMARK(BM_MapIterate<absl::btree_map<int, int>>)->Arg(1 << 16);
+#endif
@@ -0,0 +1,80 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t kElements = 100'000;
+using list_type = unrolled_list<int, 64>;
+
+list_type MakeList() {
+    list_type list;
+    for (size_t i = 0; i < kElements; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+    return list;
+}
+
+std::vector<size_t> MakeIndices() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, kElements - 1);
+    std::vector<size_t> indices(1024);
+    for (size_t& index : indices) {
+        index = dist(gen);
+    }
+    return indices;
+}
+
+template <typename Container>
+void RandomIndex(benchmark::State& state, const Container& container) {
+    auto indices = MakeIndices();
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t index : indices) {
+            sum += container[index];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+template <typename Container>
+void Scan(benchmark::State& state, const Container& container) {
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int value : container) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+void BM_IndexList(benchmark::State& state) { RandomIndex(state, MakeList()); }
+void BM_IndexFrozen(benchmark::State& state) {
+    RandomIndex(state, MakeList().freeze());
+}
+void BM_ScanList(benchmark::State& state) { Scan(state, MakeList()); }
+void BM_ScanFrozen(benchmark::State& state) {
+    Scan(state, MakeList().freeze());
+}
+
+void BM_Freeze(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        auto frozen = list.freeze();
+        benchmark::DoNotOptimize(frozen.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+}  // namespace
+
+BENCHMARK(BM_IndexList);
+BENCHMARK(BM_IndexFrozen);
+BENCHMARK(BM_ScanList);
+BENCHMARK(BM_ScanFrozen);
+BENCHMARK(BM_Freeze);
@@ -0,0 +1,93 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t kElements = 100'000'000;
+using list_type = unrolled_list<int, 256>;
+
+const list_type& BigList() {
+    static const auto list = [] {
+        auto list = std::make_unique<list_type>();
+        for (size_t i = 0; i < kElements; ++i) {
+            list->push_back(static_cast<int>(i));
+        }
+        return list;
+    }();
+    return *list;
+}
+
+std::vector<size_t> SortedIndices(size_t k) {
+    std::mt19937_64 gen(42);
+    std::vector<size_t> indices(k);
+    for (size_t& index : indices) {
+        index = gen() % kElements;
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+void BM_GatherOperatorIndex(benchmark::State& state) {
+    const list_type& list = BigList();
+    auto indices = SortedIndices(state.range(0));
+    std::vector<int> out(indices.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            out[i] = list[indices[i]];
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+void BM_GatherAdvance(benchmark::State& state) {
+    const list_type& list = BigList();
+    auto indices = SortedIndices(state.range(0));
+    std::vector<int> out(indices.size());
+    for (auto _ : state) {
+        auto it = list.begin();
+        size_t at = 0;
+        for (size_t i = 0; i < indices.size(); ++i) {
+            std::advance(it, indices[i] - at);
+            at = indices[i];
+            out[i] = *it;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+void BM_Gather(benchmark::State& state) {
+    const list_type& list = BigList();
+    auto indices = SortedIndices(state.range(0));
+    std::vector<int> out(indices.size());
+    for (auto _ : state) {
+        list.gather(indices, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+void BM_Scatter(benchmark::State& state) {
+    list_type& list = const_cast<list_type&>(BigList());
+    auto indices = SortedIndices(state.range(0));
+    std::vector<int> values(indices.size(), 1);
+    for (auto _ : state) {
+        list.scatter(indices, values);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_GatherOperatorIndex)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GatherAdvance)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Gather)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scatter)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,66 @@
+#include <indexed_unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+constexpr int kElements = 100'000;
+constexpr size_t kNodeMaxSize = 64;
+
+void BM_FindLinear(benchmark::State& state) {
+    unrolled_list<int, kNodeMaxSize> list;
+    for (int i = 0; i < kElements; ++i) {
+        list.push_back(i);
+    }
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        int key = static_cast<int>(gen() % kElements);
+        benchmark::DoNotOptimize(std::find(list.begin(), list.end(), key));
+    }
+}
+
+void BM_FindIndexed(benchmark::State& state) {
+    indexed_unrolled_list<int, kNodeMaxSize> list;
+    for (int i = 0; i < kElements; ++i) {
+        list.push_back(i);
+    }
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        int key = static_cast<int>(gen() % kElements);
+        benchmark::DoNotOptimize(list.find(key));
+    }
+    state.counters["index_bytes_per_element"] =
+        static_cast<double>(list.index_bytes()) / kElements;
+}
+
+template <typename List>
+void RandomInserts(benchmark::State& state) {
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        List list;
+        for (int i = 0; i < 10'000; ++i) {
+            auto pos = list.begin();
+            std::advance(pos, gen() % (list.size() / kNodeMaxSize + 1));
+            list.insert(pos, i);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * 10'000);
+}
+
+void BM_InsertPlain(benchmark::State& state) {
+    RandomInserts<unrolled_list<int, kNodeMaxSize>>(state);
+}
+void BM_InsertIndexed(benchmark::State& state) {
+    RandomInserts<indexed_unrolled_list<int, kNodeMaxSize>>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FindLinear);
+BENCHMARK(BM_FindIndexed);
+BENCHMARK(BM_InsertPlain);
+BENCHMARK(BM_InsertIndexed);
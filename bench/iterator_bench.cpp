@@ -0,0 +1,116 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <list>
+#include <numeric>
+
+namespace {
+
+template <size_t NodeMaxSize>
+unrolled_list<int, NodeMaxSize> MakeList(size_t n) {
+    unrolled_list<int, NodeMaxSize> list;
+    for (size_t i = 0; i < n; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+    return list;
+}
+
+template <size_t NodeMaxSize>
+void BM_ScanLoop(benchmark::State& state) {
+    auto list = MakeList<NodeMaxSize>(state.range(0));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int value : list) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <size_t NodeMaxSize>
+void BM_Find(benchmark::State& state) {
+    auto list = MakeList<NodeMaxSize>(state.range(0));
+    const int missing = -1;
+    for (auto _ : state) {
+        auto it = std::find(list.begin(), list.end(), missing);
+        benchmark::DoNotOptimize(it);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StdListScanLoop(benchmark::State& state) {
+    std::list<int> list(state.range(0));
+    std::iota(list.begin(), list.end(), 0);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int value : list) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScanLoop<10>)->Arg(1 << 20);
+BENCHMARK(BM_ScanLoop<64>)->Arg(1 << 20);
+BENCHMARK(BM_Find<10>)->Arg(1 << 20);
+BENCHMARK(BM_Find<64>)->Arg(1 << 20);
+BENCHMARK(BM_StdListScanLoop)->Arg(1 << 20);
+
+namespace {
+
+template <size_t NodeMaxSize>
+void BM_ReverseScanLoop(benchmark::State& state) {
+    auto list = MakeList<NodeMaxSize>(state.range(0));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = list.rbegin(); it != list.rend(); ++it) {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <size_t NodeMaxSize>
+void BM_StdReverseIteratorScanLoop(benchmark::State& state) {
+    auto list = MakeList<NodeMaxSize>(state.range(0));
+    using adaptor = std::reverse_iterator<typename unrolled_list<int, NodeMaxSize>::iterator>;
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = adaptor(list.end()); it != adaptor(list.begin()); ++it) {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <size_t NodeMaxSize>
+void BM_ReverseSegmentScan(benchmark::State& state) {
+    auto list = MakeList<NodeMaxSize>(state.range(0));
+    for (auto _ : state) {
+        long long sum = 0;
+        list.for_each_segment_reverse([&](std::span<int> segment) {
+            for (size_t i = segment.size(); i-- > 0;) {
+                sum += segment[i];
+            }
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReverseScanLoop<10>)->Arg(1 << 20);
+BENCHMARK(BM_ReverseScanLoop<64>)->Arg(1 << 20);
+BENCHMARK(BM_StdReverseIteratorScanLoop<10>)->Arg(1 << 20);
+BENCHMARK(BM_StdReverseIteratorScanLoop<64>)->Arg(1 << 20);
+BENCHMARK(BM_ReverseSegmentScan<10>)->Arg(1 << 20);
+BENCHMARK(BM_ReverseSegmentScan<64>)->Arg(1 << 20);
@@ -0,0 +1,32 @@
+#include <magazine_allocator.h>
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <typename Allocator>
+void BM_BuildAndDestroy(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        unrolled_list<int, 16, Allocator> list;
+        for (int i = 0; i < n; ++i) {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_BuildAndDestroy<std::allocator<int>>)
+    ->Arg(4096)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK(BM_BuildAndDestroy<magazine_allocator<int>>)
+    ->Arg(4096)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
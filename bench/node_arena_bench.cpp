@@ -0,0 +1,61 @@
+#include <node_arena.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t kVertices = 1'000'000;
+constexpr size_t kEdges = 10'000'000;
+constexpr size_t kNodeMaxSize = 8;
+
+std::vector<std::pair<uint32_t, uint32_t>> MakeEdges() {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> vertex(0, kVertices - 1);
+    std::vector<std::pair<uint32_t, uint32_t>> edges(kEdges);
+    for (auto& [from, to] : edges) {
+        from = vertex(rng);
+        to = vertex(rng);
+    }
+    return edges;
+}
+
+const std::vector<std::pair<uint32_t, uint32_t>>& Edges() {
+    static const auto edges = MakeEdges();
+    return edges;
+}
+
+void BM_AdjacencyStdAllocator(benchmark::State& state) {
+    const auto& edges = Edges();
+    for (auto _ : state) {
+        std::vector<unrolled_list<uint32_t, kNodeMaxSize>> adjacency(kVertices);
+        for (auto [from, to] : edges) {
+            adjacency[from].push_back(to);
+        }
+        benchmark::DoNotOptimize(adjacency.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kEdges);
+}
+
+void BM_AdjacencyNodeArena(benchmark::State& state) {
+    const auto& edges = Edges();
+    using arena_type = node_arena<uint32_t, kNodeMaxSize>;
+    for (auto _ : state) {
+        arena_type arena(4096);
+        std::vector<arena_type::list_type> adjacency(kVertices,
+                                                     arena.make_list());
+        for (auto [from, to] : edges) {
+            adjacency[from].push_back(to);
+        }
+        benchmark::DoNotOptimize(adjacency.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kEdges);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AdjacencyStdAllocator)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AdjacencyNodeArena)->Unit(benchmark::kMillisecond);
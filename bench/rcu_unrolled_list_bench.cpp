@@ -0,0 +1,49 @@
+#include <rcu_unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using rcu_type = rcu_unrolled_list<int, 32>;
+
+rcu_type& Table() {
+    static rcu_type table(unrolled_list<int, 32>(256, 1));
+    return table;
+}
+
+std::atomic<bool> publishing = false;
+std::thread publisher;
+
+void BM_RcuReaders(benchmark::State& state) {
+    if (state.thread_index() == 0 && state.range(0) != 0) {
+        publishing = true;
+        publisher = std::thread([] {
+            int version = 0;
+            while (publishing.load()) {
+                Table().publish(unrolled_list<int, 32>(256, ++version));
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+    }
+
+    auto reader = Table().make_reader();
+    for (auto _ : state) {
+        auto snapshot = reader.read();
+        benchmark::DoNotOptimize(snapshot->front() + snapshot->back());
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0 && state.range(0) != 0) {
+        publishing = false;
+        publisher.join();
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_RcuReaders)->Arg(0)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_RcuReaders)->Arg(1)->ThreadRange(1, 16)->UseRealTime();
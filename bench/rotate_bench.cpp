@@ -0,0 +1,39 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+constexpr int kElements = 1'000'000;
+using list_type = unrolled_list<int, 64>;
+
+list_type MakeList() {
+    list_type list;
+    for (int i = 0; i < kElements; ++i) {
+        list.push_back(i);
+    }
+    return list;
+}
+
+void BM_StdRotate(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        auto middle = std::next(list.begin(), kElements / 3 + 7);
+        benchmark::DoNotOptimize(std::rotate(list.begin(), middle, list.end()));
+    }
+}
+
+void BM_MemberRotate(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.rotate_left(kElements / 3 + 7));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_StdRotate);
+BENCHMARK(BM_MemberRotate);
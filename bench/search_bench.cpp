@@ -0,0 +1,53 @@
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+constexpr int kElements = 1'000'000;
+using list_type = unrolled_list<int, 64>;
+
+list_type MakeSortedList() {
+    list_type list;
+    for (int i = 0; i < kElements; ++i) {
+        list.push_back(i * 2);
+    }
+    return list;
+}
+
+void BM_StdLowerBound(benchmark::State& state) {
+    list_type list = MakeSortedList();
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        int key = static_cast<int>(gen() % (2 * kElements));
+        benchmark::DoNotOptimize(
+            std::lower_bound(list.begin(), list.end(), key));
+    }
+}
+
+void BM_MemberLowerBound(benchmark::State& state) {
+    list_type list = MakeSortedList();
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        int key = static_cast<int>(gen() % (2 * kElements));
+        benchmark::DoNotOptimize(list.lower_bound(key));
+    }
+}
+
+void BM_StdFind(benchmark::State& state) {
+    list_type list = MakeSortedList();
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        int key = static_cast<int>(gen() % kElements) * 2;
+        benchmark::DoNotOptimize(std::find(list.begin(), list.end(), key));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_StdLowerBound);
+BENCHMARK(BM_MemberLowerBound);
+BENCHMARK(BM_StdFind);
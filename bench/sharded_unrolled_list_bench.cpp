@@ -0,0 +1,49 @@
+#include <sharded_unrolled_list.h>
+#include <unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <mutex>
+
+namespace {
+
+constexpr int kShards = 64;
+
+std::unique_ptr<sharded_unrolled_list<int, 64>> sharded;
+std::unique_ptr<unrolled_list<int, 64>> shared;
+std::mutex shared_mutex;
+
+void BM_ShardedAppend(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        sharded = std::make_unique<sharded_unrolled_list<int, 64>>(kShards);
+    }
+    int i = 0;
+    for (auto _ : state) {
+        sharded->push_back(i++);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        benchmark::DoNotOptimize(sharded->collapse().size());
+    }
+}
+
+void BM_MutexAppend(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        shared = std::make_unique<unrolled_list<int, 64>>();
+    }
+    int i = 0;
+    for (auto _ : state) {
+        std::lock_guard lock(shared_mutex);
+        shared->push_back(i++);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        benchmark::DoNotOptimize(shared->size());
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ShardedAppend)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_MutexAppend)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,84 @@
+#include <sliding_window_aggregator.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int kStream = 1 << 20;
+
+struct Max {
+    int operator()(int lhs, int rhs) const { return std::max(lhs, rhs); }
+};
+
+std::vector<int> MakeStream() {
+    std::mt19937 gen(42);
+    std::vector<int> stream(kStream);
+    for (int& value : stream) {
+        value = static_cast<int>(gen() % 1'000'000);
+    }
+    return stream;
+}
+
+void BM_DequeMonotonicMax(benchmark::State& state) {
+    const auto stream = MakeStream();
+    const std::size_t width = state.range(0);
+    for (auto _ : state) {
+        std::deque<std::pair<std::size_t, int>> queue;
+        long long checksum = 0;
+        for (std::size_t i = 0; i < stream.size(); ++i) {
+            while (!queue.empty() && queue.back().second <= stream[i]) {
+                queue.pop_back();
+            }
+            queue.emplace_back(i, stream[i]);
+            if (queue.front().first + width <= i) queue.pop_front();
+            checksum += queue.front().second;
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * kStream);
+}
+
+void BM_WindowAggregatorMax(benchmark::State& state) {
+    const auto stream = MakeStream();
+    const std::size_t width = state.range(0);
+    for (auto _ : state) {
+        sliding_window_aggregator<int, Max, 64> window;
+        long long checksum = 0;
+        for (int value : stream) {
+            window.push_back(value);
+            if (window.size() > width) window.pop_front();
+            checksum += window.aggregate();
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * kStream);
+}
+
+void BM_WindowAggregatorSum(benchmark::State& state) {
+    const auto stream = MakeStream();
+    const std::size_t width = state.range(0);
+    for (auto _ : state) {
+        sliding_window_aggregator<long long, std::plus<>, 64> window;
+        long long checksum = 0;
+        for (int value : stream) {
+            window.push_back(value);
+            if (window.size() > width) window.pop_front();
+            checksum += window.aggregate();
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * kStream);
+}
+
+}  // namespace
+
+BENCHMARK(BM_DequeMonotonicMax)->Arg(64)->Arg(4096);
+BENCHMARK(BM_WindowAggregatorMax)->Arg(64)->Arg(4096);
+BENCHMARK(BM_WindowAggregatorSum)->Arg(64)->Arg(4096);
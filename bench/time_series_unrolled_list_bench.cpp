@@ -0,0 +1,90 @@
+#include <time_series_unrolled_list.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+namespace {
+
+constexpr std::int64_t kSamples = 100'000'000;
+constexpr std::int64_t kSweeps = 100;
+
+struct Sample {
+    std::int64_t time;
+    float value;
+};
+
+struct SampleTime {
+    std::int64_t operator()(const Sample& sample) const { return sample.time; }
+};
+
+using series_type = time_series_unrolled_list<Sample, 256, SampleTime>;
+
+// Every sweep expires the oldest 1% of the samples, the way a retention
+// job trims a metrics store.
+void BM_DequeRetentionSweep(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto samples = std::make_unique<std::deque<Sample>>();
+        for (std::int64_t i = 0; i < kSamples; ++i) {
+            samples->push_back({i, 1.0f});
+        }
+        state.ResumeTiming();
+
+        for (std::int64_t sweep = 1; sweep <= kSweeps; ++sweep) {
+            std::int64_t cutoff = kSamples / kSweeps * sweep + 17;
+            while (!samples->empty() && samples->front().time < cutoff) {
+                samples->pop_front();
+            }
+        }
+        benchmark::DoNotOptimize(samples->size());
+
+        state.PauseTiming();
+        samples.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kSamples);
+}
+
+void BM_TimeSeriesRetentionSweep(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto series = std::make_unique<series_type>();
+        for (std::int64_t i = 0; i < kSamples; ++i) {
+            series->push_back({i, 1.0f});
+        }
+        state.ResumeTiming();
+
+        for (std::int64_t sweep = 1; sweep <= kSweeps; ++sweep) {
+            std::int64_t cutoff = kSamples / kSweeps * sweep + 17;
+            benchmark::DoNotOptimize(series->expire_before(cutoff));
+        }
+
+        state.PauseTiming();
+        series.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kSamples);
+}
+
+void BM_TimeSeriesSeek(benchmark::State& state) {
+    auto series = std::make_unique<series_type>();
+    for (std::int64_t i = 0; i < kSamples; ++i) {
+        series->push_back({i, 1.0f});
+    }
+    std::int64_t time = 0;
+    for (auto _ : state) {
+        time = (time + 7'919'011) % kSamples;
+        benchmark::DoNotOptimize(series->seek(time));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_DequeRetentionSweep)->Iterations(2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TimeSeriesRetentionSweep)
+    ->Iterations(2)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TimeSeriesSeek);
@@ -0,0 +1,86 @@
+#include <unrolled_hash_set.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+constexpr size_t kElements = 1 << 18;
+
+std::vector<std::uint64_t> RandomKeys(unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<std::uint64_t> keys(kElements);
+    for (auto& key : keys) {
+        key = gen();
+    }
+    return keys;
+}
+
+template <typename Set>
+void BM_HashInsert(benchmark::State& state) {
+    auto keys = RandomKeys(1);
+    for (auto _ : state) {
+        Set set;
+        for (auto key : keys) {
+            set.insert(key);
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+template <typename Set>
+void HashLookup(benchmark::State& state, unsigned probe_seed) {
+    auto keys = RandomKeys(1);
+    auto probes = RandomKeys(probe_seed);
+    Set set;
+    for (auto key : keys) {
+        set.insert(key);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.find(probes[i++ % kElements]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["load_factor"] = set.load_factor();
+}
+
+template <typename Set>
+void BM_HashFindHit(benchmark::State& state) {
+    HashLookup<Set>(state, 1);
+}
+template <typename Set>
+void BM_HashFindMiss(benchmark::State& state) {
+    HashLookup<Set>(state, 2);
+}
+
+void BM_HashMemory(benchmark::State& state) {
+    auto keys = RandomKeys(1);
+    unrolled_hash_set<std::uint64_t> set;
+    for (auto key : keys) {
+        set.insert(key);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.memory_usage());
+    }
+    state.counters["bytes_per_element"] =
+        static_cast<double>(set.memory_usage()) / kElements;
+    state.counters["nodes"] = static_cast<double>(set.node_count());
+}
+
+using unrolled_set_type = unrolled_hash_set<std::uint64_t>;
+using std_set_type = std::unordered_set<std::uint64_t>;
+
+}  // namespace
+
+BENCHMARK(BM_HashInsert<unrolled_set_type>);
+BENCHMARK(BM_HashInsert<std_set_type>);
+BENCHMARK(BM_HashFindHit<unrolled_set_type>);
+BENCHMARK(BM_HashFindHit<std_set_type>);
+BENCHMARK(BM_HashFindMiss<unrolled_set_type>);
+BENCHMARK(BM_HashFindMiss<std_set_type>);
+BENCHMARK(BM_HashMemory);
@@ -0,0 +1,85 @@
+#include <unrolled_list_columns.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Trade {
+    std::int64_t time;
+    double price;
+    int volume;
+};
+
+constexpr size_t kElements = 1 << 20;
+using list_type = unrolled_list<double, 256>;
+
+list_type MakeList() {
+    list_type list;
+    for (size_t i = 0; i < kElements; ++i) {
+        list.push_back(static_cast<double>(i));
+    }
+    return list;
+}
+
+void BM_ColumnElementwise(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        std::vector<double> column;
+        column.reserve(list.size());
+        for (double value : list) {
+            column.push_back(value);
+        }
+        benchmark::DoNotOptimize(column.data());
+    }
+    state.SetBytesProcessed(state.iterations() * kElements * sizeof(double));
+}
+
+void BM_ColumnExport(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        auto column = export_column(list);
+        benchmark::DoNotOptimize(column.data());
+    }
+    state.SetBytesProcessed(state.iterations() * kElements * sizeof(double));
+}
+
+void BM_ColumnChunks(benchmark::State& state) {
+    list_type list = MakeList();
+    for (auto _ : state) {
+        auto chunks = export_chunks(list);
+        benchmark::DoNotOptimize(chunks.data());
+    }
+    state.SetBytesProcessed(state.iterations() * kElements * sizeof(double));
+}
+
+void BM_ColumnImport(benchmark::State& state) {
+    auto column = export_column(MakeList());
+    for (auto _ : state) {
+        list_type list(column.span());
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetBytesProcessed(state.iterations() * kElements * sizeof(double));
+}
+
+void BM_ColumnStructField(benchmark::State& state) {
+    unrolled_list<Trade, 256> list;
+    for (size_t i = 0; i < kElements; ++i) {
+        list.push_back({static_cast<std::int64_t>(i), 1.0, 1});
+    }
+    for (auto _ : state) {
+        auto column = export_column(list, &Trade::price);
+        benchmark::DoNotOptimize(column.data());
+    }
+    state.SetBytesProcessed(state.iterations() * kElements * sizeof(double));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ColumnElementwise);
+BENCHMARK(BM_ColumnExport);
+BENCHMARK(BM_ColumnChunks);
+BENCHMARK(BM_ColumnImport);
+BENCHMARK(BM_ColumnStructField);
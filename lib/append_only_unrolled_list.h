@@ -0,0 +1,193 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class append_only_unrolled_list {
+   public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+
+   private:
+    using Node = unrolled_list_node<T, NodeMaxSize>;
+    using node_allocator =
+        typename allocator_traits::template rebind_alloc<Node>;
+    using node_allocator_traits = std::allocator_traits<node_allocator>;
+
+    static size_type load_count(const Node* node) {
+        return std::atomic_ref<size_type>(const_cast<Node*>(node)->count)
+            .load(std::memory_order_acquire);
+    }
+    static const Node* load_next(const Node* node) {
+        return std::atomic_ref<Node*>(const_cast<Node*>(node)->next)
+            .load(std::memory_order_acquire);
+    }
+
+   public:
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+
+        const_iterator()
+            : current_node(nullptr),
+              current(nullptr),
+              node_end(nullptr),
+              remaining(0) {}
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
+        const_iterator& operator++() {
+            if (++current == node_end) {
+                enter(remaining ? load_next(current_node) : nullptr);
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const {
+            return current == other.current;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+       private:
+        const Node* current_node;
+        const T* current;
+        const T* node_end;
+        size_type remaining;
+
+        const_iterator(const Node* node, size_type size) : remaining(size) {
+            enter(size ? node : nullptr);
+        }
+
+        void enter(const Node* node) {
+            current_node = node;
+            if (!node) {
+                current = node_end = nullptr;
+                return;
+            }
+            size_type available = std::min(load_count(node), remaining);
+            remaining -= available;
+            current = node->elem(0);
+            node_end = current + available;
+        }
+
+        friend class append_only_unrolled_list;
+    };
+
+    class snapshot {
+       public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_iterator = append_only_unrolled_list::const_iterator;
+        using iterator = const_iterator;
+
+        const_iterator begin() const { return const_iterator(head, count); }
+        const_iterator end() const { return const_iterator(); }
+        size_type size() const { return count; }
+        bool empty() const { return count == 0; }
+
+       private:
+        const Node* head;
+        size_type count;
+
+        snapshot(const Node* head, size_type count)
+            : head(head), count(count) {}
+
+        friend class append_only_unrolled_list;
+    };
+
+    append_only_unrolled_list() : append_only_unrolled_list(Allocator()) {}
+    explicit append_only_unrolled_list(const allocator_type& alloc)
+        : allocator(alloc), node_alloc(allocator) {}
+    append_only_unrolled_list(const append_only_unrolled_list&) = delete;
+    append_only_unrolled_list& operator=(const append_only_unrolled_list&) =
+        delete;
+    ~append_only_unrolled_list() {
+        Node* cur = head.load(std::memory_order_relaxed);
+        while (cur) {
+            Node* next = cur->next;
+            for (size_type i = 0; i < cur->count; ++i) {
+                allocator_traits::destroy(allocator, cur->elem(i));
+            }
+            node_allocator_traits::destroy(node_alloc, cur);
+            node_allocator_traits::deallocate(node_alloc, cur, 1);
+            cur = next;
+        }
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        size_type tail_count =
+            tail ? std::atomic_ref<size_type>(tail->count).load(
+                       std::memory_order_relaxed)
+                 : NodeMaxSize;
+        if (tail_count == NodeMaxSize) {
+            Node* node = node_allocator_traits::allocate(node_alloc, 1);
+            node_allocator_traits::construct(node_alloc, node);
+            try {
+                allocator_traits::construct(allocator, node->elem(0),
+                                            std::forward<Args>(args)...);
+            } catch (...) {
+                node_allocator_traits::destroy(node_alloc, node);
+                node_allocator_traits::deallocate(node_alloc, node, 1);
+                throw;
+            }
+            node->count = 1;
+            node->prev = tail;
+            if (tail) {
+                std::atomic_ref<Node*>(tail->next).store(
+                    node, std::memory_order_release);
+            } else {
+                head.store(node, std::memory_order_release);
+            }
+            tail = node;
+        } else {
+            allocator_traits::construct(allocator, tail->elem(tail_count),
+                                        std::forward<Args>(args)...);
+            std::atomic_ref<size_type>(tail->count)
+                .store(tail_count + 1, std::memory_order_release);
+        }
+        published_size.store(written_size + 1, std::memory_order_release);
+        ++written_size;
+    }
+
+    snapshot read() const {
+        size_type count = published_size.load(std::memory_order_acquire);
+        return snapshot(head.load(std::memory_order_acquire), count);
+    }
+    size_type size() const {
+        return published_size.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    allocator_type get_allocator() const { return allocator; }
+
+   private:
+    std::atomic<Node*> head{nullptr};
+    Node* tail = nullptr;
+    size_type written_size = 0;
+    alignas(64) std::atomic<size_type> published_size{0};
+    allocator_type allocator;
+    node_allocator node_alloc;
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class bounded_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = typename list_type::const_iterator;
+    using iterator = const_iterator;
+    using const_reverse_iterator = typename list_type::const_reverse_iterator;
+    using reverse_iterator = const_reverse_iterator;
+
+    explicit bounded_unrolled_list(size_type node_budget,
+                                   const allocator_type& alloc = Allocator())
+        : list(alloc), budget(node_budget) {
+        if (budget == 0) {
+            throw std::invalid_argument("Node budget must be positive");
+        }
+    }
+    bounded_unrolled_list(const bounded_unrolled_list&) = delete;
+    bounded_unrolled_list& operator=(const bounded_unrolled_list&) = delete;
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        if (list.tail && list.tail->count < NodeMaxSize) {
+            list.append_value(std::forward<Args>(args)...);
+            return;
+        }
+        if (nodes < budget) {
+            list.append_value(std::forward<Args>(args)...);
+            ++nodes;
+            return;
+        }
+        list.link_tail_node(list.detach_head());
+        try {
+            list.append_value(std::forward<Args>(args)...);
+        } catch (...) {
+            --nodes;
+            throw;
+        }
+    }
+    void pop_front() {
+        if (list.head->count > 1) {
+            list.pop_front();
+            return;
+        }
+        list.retain_node(list.detach_head());
+        --nodes;
+    }
+    void clear() noexcept {
+        list.reset();
+        nodes = 0;
+    }
+
+    const_reference front() const { return list.front(); }
+    const_reference back() const { return list.back(); }
+
+    const_iterator begin() const { return list.begin(); }
+    const_iterator cbegin() const { return list.cbegin(); }
+    const_iterator end() const { return list.end(); }
+    const_iterator cend() const { return list.cend(); }
+    const_reverse_iterator rbegin() const { return list.rbegin(); }
+    const_reverse_iterator rend() const { return list.rend(); }
+
+    bool empty() const { return list.empty(); }
+    size_type size() const { return list.size(); }
+    size_type capacity() const { return budget * NodeMaxSize; }
+    size_type node_budget() const { return budget; }
+    size_type node_count() const { return nodes; }
+    const list_type& items() const { return list; }
+
+   private:
+    list_type list;
+    size_type budget;
+    size_type nodes = 0;
+};
@@ -0,0 +1,205 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+class epoch_domain {
+   private:
+    struct alignas(64) record {
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<bool> in_use{true};
+        record* next = nullptr;
+    };
+
+    struct retired_object {
+        void* object;
+        void (*deleter)(void* object, void* context);
+        void* context;
+        std::uint64_t epoch;
+    };
+
+   public:
+    using size_type = std::size_t;
+    using deleter_type = void (*)(void* object, void* context);
+
+    class guard {
+       public:
+        guard(guard&& other) noexcept : rec(other.rec) { other.rec = nullptr; }
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+        ~guard() {
+            if (rec) rec->epoch.store(0, std::memory_order_release);
+        }
+
+       private:
+        record* rec;
+
+        explicit guard(record* rec) : rec(rec) {}
+
+        friend class epoch_domain;
+    };
+
+    class participant {
+       public:
+        participant(participant&& other) noexcept
+            : domain(other.domain),
+              rec(other.rec),
+              retired(std::move(other.retired)) {
+            other.rec = nullptr;
+        }
+        participant(const participant&) = delete;
+        participant& operator=(const participant&) = delete;
+        ~participant() {
+            if (!rec) return;
+            reclaim();
+            if (!retired.empty()) domain->adopt(retired);
+            rec->in_use.store(false, std::memory_order_release);
+        }
+
+        guard pin() const {
+            assert(rec->epoch.load(std::memory_order_relaxed) == 0);
+            rec->epoch.store(
+                domain->global_epoch.load(std::memory_order_seq_cst),
+                std::memory_order_seq_cst);
+            return guard(rec);
+        }
+
+        void reserve(size_type count) {
+            retired.reserve(retired.size() + count);
+        }
+
+        void retire(void* object, deleter_type deleter,
+                    void* context = nullptr) {
+            retired.push_back(
+                {object, deleter, context,
+                 domain->global_epoch.fetch_add(1, std::memory_order_seq_cst)});
+            if (retired.size() >= domain->batch_size) reclaim();
+        }
+        template <typename U>
+        void retire(U* object) {
+            retire(object,
+                   [](void* p, void*) { delete static_cast<U*>(p); });
+        }
+
+        template <typename Alloc>
+        void retire_allocated(
+            Alloc& alloc,
+            typename std::allocator_traits<Alloc>::value_type* object) {
+            retire(
+                object,
+                [](void* p, void* context) {
+                    using traits = std::allocator_traits<Alloc>;
+                    auto& a = *static_cast<Alloc*>(context);
+                    auto* obj = static_cast<typename traits::value_type*>(p);
+                    traits::destroy(a, obj);
+                    traits::deallocate(a, obj, 1);
+                },
+                &alloc);
+        }
+
+        size_type reclaim() {
+            return free_expired(retired, domain->min_active_epoch());
+        }
+        size_type pending() const { return retired.size(); }
+
+       private:
+        epoch_domain* domain;
+        record* rec;
+        std::vector<retired_object> retired;
+
+        participant(epoch_domain* domain, record* rec)
+            : domain(domain), rec(rec) {}
+
+        friend class epoch_domain;
+    };
+
+    explicit epoch_domain(size_type batch_size = 64)
+        : batch_size(batch_size ? batch_size : 1) {}
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+    ~epoch_domain() {
+        for (retired_object& r : orphans) {
+            r.deleter(r.object, r.context);
+        }
+        record* rec = records.load(std::memory_order_relaxed);
+        while (rec) {
+            record* next = rec->next;
+            delete rec;
+            rec = next;
+        }
+    }
+
+    participant register_thread() {
+        for (record* rec = records.load(std::memory_order_acquire); rec;
+             rec = rec->next) {
+            bool expected = false;
+            if (rec->in_use.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire)) {
+                return participant(this, rec);
+            }
+        }
+        record* rec = new record();
+        rec->next = records.load(std::memory_order_relaxed);
+        while (!records.compare_exchange_weak(rec->next, rec,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+        }
+        return participant(this, rec);
+    }
+
+    size_type reclaim_orphans() {
+        std::lock_guard lock(orphans_mutex);
+        return free_expired(orphans, min_active_epoch());
+    }
+
+    std::uint64_t current_epoch() const {
+        return global_epoch.load(std::memory_order_acquire);
+    }
+
+   private:
+    std::atomic<std::uint64_t> global_epoch{1};
+    std::atomic<record*> records{nullptr};
+    size_type batch_size;
+    std::mutex orphans_mutex;
+    std::vector<retired_object> orphans;
+
+    std::uint64_t min_active_epoch() const {
+        std::uint64_t min_active =
+            global_epoch.load(std::memory_order_seq_cst);
+        for (record* rec = records.load(std::memory_order_acquire); rec;
+             rec = rec->next) {
+            std::uint64_t epoch = rec->epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0 && epoch < min_active) min_active = epoch;
+        }
+        return min_active;
+    }
+
+    void adopt(std::vector<retired_object>& retired) noexcept {
+        try {
+            std::lock_guard lock(orphans_mutex);
+            orphans.insert(orphans.end(), retired.begin(), retired.end());
+            retired.clear();
+        } catch (...) {
+        }
+    }
+
+    static size_type free_expired(std::vector<retired_object>& retired,
+                                  std::uint64_t min_active) {
+        auto alive = retired.begin();
+        for (auto it = retired.begin(); it != retired.end(); ++it) {
+            if (it->epoch < min_active) {
+                it->deleter(it->object, it->context);
+            } else {
+                *alive++ = *it;
+            }
+        }
+        size_type freed = retired.end() - alive;
+        retired.erase(alive, retired.end());
+        return freed;
+    }
+};
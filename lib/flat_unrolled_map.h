@@ -0,0 +1,388 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename K, typename V, size_t NodeMaxSize>
+struct flat_unrolled_map_node {
+    std::size_t count;
+    flat_unrolled_map_node* next;
+    flat_unrolled_map_node* prev;
+    alignas(K) std::byte key_data[sizeof(K) * NodeMaxSize];
+    alignas(V) std::byte value_data[sizeof(V) * NodeMaxSize];
+
+    flat_unrolled_map_node() : count(0), next(nullptr), prev(nullptr) {}
+
+    K* key(std::size_t index) {
+        return &reinterpret_cast<K*>(key_data)[index];
+    }
+    const K* key(std::size_t index) const {
+        return &reinterpret_cast<const K*>(key_data)[index];
+    }
+    V* value(std::size_t index) {
+        return &reinterpret_cast<V*>(value_data)[index];
+    }
+    const V* value(std::size_t index) const {
+        return &reinterpret_cast<const V*>(value_data)[index];
+    }
+};
+
+template <typename K, typename V, size_t NodeMaxSize = 32,
+          typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class flat_unrolled_map {
+    static_assert(NodeMaxSize >= 2, "a node has to hold at least two keys");
+
+   public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+   private:
+    using Node = flat_unrolled_map_node<K, V, NodeMaxSize>;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using node_allocator =
+        typename allocator_traits::template rebind_alloc<Node>;
+    using node_allocator_traits = std::allocator_traits<node_allocator>;
+
+    struct route {
+        K front;
+        Node* node;
+    };
+    using route_allocator =
+        typename allocator_traits::template rebind_alloc<route>;
+
+    template <bool Const>
+    class basic_iterator {
+        using node_pointer = std::conditional_t<Const, const Node*, Node*>;
+        using mapped_reference = std::conditional_t<Const, const V&, V&>;
+
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const K, V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const K&, mapped_reference>;
+
+        struct pointer {
+            reference ref;
+            const reference* operator->() const { return &ref; }
+        };
+
+        basic_iterator() : node(nullptr), index(0) {}
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst>& other)
+            : node(other.node), index(other.index) {}
+
+        reference operator*() const {
+            return {*node->key(index), *node->value(index)};
+        }
+        pointer operator->() const { return {**this}; }
+        const K& key() const { return *node->key(index); }
+        mapped_reference value() const { return *node->value(index); }
+
+        basic_iterator& operator++() {
+            if (++index == node->count) {
+                node = node->next;
+                index = 0;
+            }
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const basic_iterator& other) const {
+            return node == other.node && index == other.index;
+        }
+        bool operator!=(const basic_iterator& other) const {
+            return !(*this == other);
+        }
+
+       private:
+        node_pointer node;
+        size_type index;
+
+        basic_iterator(node_pointer node, size_type index)
+            : node(node), index(index) {}
+
+        friend class flat_unrolled_map;
+        friend class basic_iterator<!Const>;
+    };
+
+   public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    flat_unrolled_map() : flat_unrolled_map(Allocator()) {}
+    explicit flat_unrolled_map(const allocator_type& alloc)
+        : head(nullptr),
+          total_size(0),
+          allocator(alloc),
+          node_alloc(alloc),
+          routes(route_allocator(alloc)) {}
+    flat_unrolled_map(std::initializer_list<value_type> ilist,
+                      const allocator_type& alloc = Allocator())
+        : flat_unrolled_map(alloc) {
+        for (const value_type& value : ilist) {
+            insert(value);
+        }
+    }
+    flat_unrolled_map(const flat_unrolled_map&) = delete;
+    flat_unrolled_map& operator=(const flat_unrolled_map&) = delete;
+    flat_unrolled_map(flat_unrolled_map&& other) noexcept
+        : head(other.head),
+          total_size(other.total_size),
+          allocator(other.allocator),
+          node_alloc(std::move(other.node_alloc)),
+          routes(std::move(other.routes)) {
+        other.head = nullptr;
+        other.total_size = 0;
+        other.routes.clear();
+    }
+    ~flat_unrolled_map() { clear(); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+        if (!head) {
+            K new_key(key);
+            V new_value(std::forward<Args>(args)...);
+            routes.reserve(1);
+            head = create_node();
+            allocator_traits::construct(allocator, head->key(0),
+                                        std::move(new_key));
+            allocator_traits::construct(allocator, head->value(0),
+                                        std::move(new_value));
+            head->count = 1;
+            total_size = 1;
+            routes.push_back({*head->key(0), head});
+            return {iterator(head, 0), true};
+        }
+        size_type r = route_index(key);
+        Node* node = routes[r].node;
+        size_type i = lower_bound_in_node(node, key);
+        if (i < node->count && !compare(key, *node->key(i))) {
+            return {iterator(node, i), false};
+        }
+
+        K new_key(key);
+        V new_value(std::forward<Args>(args)...);
+        if (node->count == NodeMaxSize) {
+            Node* upper = split(r);
+            if (i > node->count) {
+                i -= node->count;
+                node = upper;
+                ++r;
+            }
+        }
+        shift_right(node, i);
+        allocator_traits::construct(allocator, node->key(i),
+                                    std::move(new_key));
+        allocator_traits::construct(allocator, node->value(i),
+                                    std::move(new_value));
+        ++node->count;
+        ++total_size;
+        if (i == 0) routes[r].front = *node->key(0);
+        return {iterator(node, i), true};
+    }
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const K& key, Args&&... args) {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    V& operator[](const K& key) { return try_emplace(key).first.value(); }
+    V& at(const K& key) {
+        iterator it = find(key);
+        if (it == end()) throw std::out_of_range("Key not found");
+        return it.value();
+    }
+    const V& at(const K& key) const {
+        const_iterator it = find(key);
+        if (it == end()) throw std::out_of_range("Key not found");
+        return it.value();
+    }
+
+    iterator find(const K& key) {
+        if (!head) return end();
+        Node* node = routes[route_index(key)].node;
+        size_type i = lower_bound_in_node(node, key);
+        if (i < node->count && !compare(key, *node->key(i))) {
+            return iterator(node, i);
+        }
+        return end();
+    }
+    const_iterator find(const K& key) const {
+        return const_cast<flat_unrolled_map*>(this)->find(key);
+    }
+    bool contains(const K& key) const { return find(key) != end(); }
+    iterator lower_bound(const K& key) {
+        if (!head) return end();
+        Node* node = routes[route_index(key)].node;
+        size_type i = lower_bound_in_node(node, key);
+        if (i == node->count) return iterator(node->next, 0);
+        return iterator(node, i);
+    }
+    const_iterator lower_bound(const K& key) const {
+        return const_cast<flat_unrolled_map*>(this)->lower_bound(key);
+    }
+
+    size_type erase(const K& key) {
+        if (!head) return 0;
+        size_type r = route_index(key);
+        Node* node = routes[r].node;
+        size_type i = lower_bound_in_node(node, key);
+        if (i == node->count || compare(key, *node->key(i))) return 0;
+
+        allocator_traits::destroy(allocator, node->key(i));
+        allocator_traits::destroy(allocator, node->value(i));
+        shift_left(node, i);
+        --node->count;
+        --total_size;
+        if (node->count == 0) {
+            remove_node(r);
+        } else if (i == 0) {
+            routes[r].front = *node->key(0);
+        }
+        return 1;
+    }
+    void clear() noexcept {
+        Node* cur = head;
+        while (cur) {
+            Node* next = cur->next;
+            destroy_node(cur);
+            cur = next;
+        }
+        head = nullptr;
+        total_size = 0;
+        routes.clear();
+    }
+
+    iterator begin() { return iterator(head, 0); }
+    const_iterator begin() const { return const_iterator(head, 0); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return total_size == 0; }
+    size_type size() const { return total_size; }
+    size_type node_count() const { return routes.size(); }
+    key_compare key_comp() const { return compare; }
+
+   private:
+    static constexpr bool vectorizable_keys =
+        std::is_arithmetic_v<K> && std::is_same_v<Compare, std::less<K>>;
+
+    Node* head;
+    size_type total_size;
+    [[no_unique_address]] Compare compare;
+    allocator_type allocator;
+    node_allocator node_alloc;
+    std::vector<route, route_allocator> routes;
+
+    size_type route_index(const K& key) const {
+        auto it = std::upper_bound(
+            routes.begin(), routes.end(), key,
+            [this](const K& k, const route& r) { return compare(k, r.front); });
+        return it == routes.begin() ? 0 : it - routes.begin() - 1;
+    }
+
+    size_type lower_bound_in_node(const Node* node, const K& key) const {
+        const K* keys = node->key(0);
+        if constexpr (vectorizable_keys) {
+            size_type less = 0;
+            for (size_type i = 0; i < node->count; ++i) {
+                less += keys[i] < key;
+            }
+            return less;
+        } else {
+            return std::lower_bound(keys, keys + node->count, key, compare) -
+                   keys;
+        }
+    }
+
+    void shift_right(Node* node, size_type from) {
+        for (size_type i = node->count; i > from; --i) {
+            allocator_traits::construct(allocator, node->key(i),
+                                        std::move(*node->key(i - 1)));
+            allocator_traits::destroy(allocator, node->key(i - 1));
+            allocator_traits::construct(allocator, node->value(i),
+                                        std::move(*node->value(i - 1)));
+            allocator_traits::destroy(allocator, node->value(i - 1));
+        }
+    }
+    void shift_left(Node* node, size_type from) {
+        for (size_type i = from + 1; i < node->count; ++i) {
+            allocator_traits::construct(allocator, node->key(i - 1),
+                                        std::move(*node->key(i)));
+            allocator_traits::destroy(allocator, node->key(i));
+            allocator_traits::construct(allocator, node->value(i - 1),
+                                        std::move(*node->value(i)));
+            allocator_traits::destroy(allocator, node->value(i));
+        }
+    }
+
+    Node* split(size_type r) {
+        Node* node = routes[r].node;
+        routes.reserve(routes.size() + 1);
+        Node* upper = create_node();
+        size_type keep = NodeMaxSize - NodeMaxSize / 2;
+        for (size_type i = keep; i < node->count; ++i) {
+            allocator_traits::construct(allocator, upper->key(i - keep),
+                                        std::move(*node->key(i)));
+            allocator_traits::destroy(allocator, node->key(i));
+            allocator_traits::construct(allocator, upper->value(i - keep),
+                                        std::move(*node->value(i)));
+            allocator_traits::destroy(allocator, node->value(i));
+        }
+        upper->count = node->count - keep;
+        node->count = keep;
+
+        upper->prev = node;
+        upper->next = node->next;
+        if (node->next) node->next->prev = upper;
+        node->next = upper;
+        routes.insert(routes.begin() + r + 1, {*upper->key(0), upper});
+        return upper;
+    }
+
+    void remove_node(size_type r) {
+        Node* node = routes[r].node;
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next) node->next->prev = node->prev;
+        destroy_node(node);
+        routes.erase(routes.begin() + r);
+    }
+
+    Node* create_node() {
+        Node* p = node_allocator_traits::allocate(node_alloc, 1);
+        node_allocator_traits::construct(node_alloc, p);
+        return p;
+    }
+    void destroy_node(Node* p) noexcept {
+        for (size_type i = 0; i < p->count; ++i) {
+            allocator_traits::destroy(allocator, p->key(i));
+            allocator_traits::destroy(allocator, p->value(i));
+        }
+        node_allocator_traits::destroy(node_alloc, p);
+        node_allocator_traits::deallocate(node_alloc, p, 1);
+    }
+};
@@ -0,0 +1,161 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class frozen_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using size_type = std::size_t;
+    using reference = const T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using iterator = const T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    frozen_unrolled_list() : frozen_unrolled_list(Allocator()) {}
+    explicit frozen_unrolled_list(const allocator_type& alloc)
+        : elements(nullptr), total_size(0), allocator(alloc) {}
+    explicit frozen_unrolled_list(const list_type& list)
+        : frozen_unrolled_list(list.get_allocator()) {
+        pack(list, [](const T& value) -> const T& { return value; });
+    }
+    explicit frozen_unrolled_list(list_type&& list)
+        : frozen_unrolled_list(list.get_allocator()) {
+        pack(list, [](T& value) -> T&& { return std::move(value); });
+        list.clear();
+    }
+    frozen_unrolled_list(const frozen_unrolled_list&) = delete;
+    frozen_unrolled_list& operator=(const frozen_unrolled_list&) = delete;
+    frozen_unrolled_list(frozen_unrolled_list&& other) noexcept
+        : elements(other.elements),
+          total_size(other.total_size),
+          allocator(std::move(other.allocator)) {
+        other.elements = nullptr;
+        other.total_size = 0;
+    }
+    frozen_unrolled_list& operator=(frozen_unrolled_list&& other) noexcept {
+        if (this != &other) {
+            release();
+            elements = other.elements;
+            total_size = other.total_size;
+            allocator = std::move(other.allocator);
+            other.elements = nullptr;
+            other.total_size = 0;
+        }
+        return *this;
+    }
+    ~frozen_unrolled_list() { release(); }
+
+    const_reference operator[](size_type index) const {
+        return elements[index];
+    }
+    const_reference at(size_type index) const {
+        if (index >= total_size) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+    const_reference front() const {
+        if (!total_size) throw std::out_of_range("List is empty");
+        return elements[0];
+    }
+    const_reference back() const {
+        if (!total_size) throw std::out_of_range("List is empty");
+        return elements[total_size - 1];
+    }
+    const T* data() const { return elements; }
+    std::span<const T> span() const { return {elements, total_size}; }
+
+    const_iterator begin() const { return elements; }
+    const_iterator cbegin() const { return elements; }
+    const_iterator end() const { return elements + total_size; }
+    const_iterator cend() const { return elements + total_size; }
+    const_reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+    bool empty() const { return total_size == 0; }
+    size_type size() const { return total_size; }
+    allocator_type get_allocator() const { return allocator; }
+
+    list_type thaw() const& { return list_type(span(), allocator); }
+    list_type thaw() && {
+        if constexpr (trivially_constructed) {
+            list_type list(span(), allocator);
+            release();
+            return list;
+        } else {
+            list_type list(std::make_move_iterator(begin()),
+                           std::make_move_iterator(end()), allocator);
+            release();
+            return list;
+        }
+    }
+
+   private:
+    static constexpr bool trivially_constructed =
+        std::is_trivially_copyable_v<T> &&
+        !requires(allocator_type& alloc, T* p) { alloc.construct(p, *p); };
+    static constexpr bool trivially_destroyed =
+        std::is_trivially_destructible_v<T> &&
+        !requires(allocator_type& alloc, T* p) { alloc.destroy(p); };
+
+    T* elements;
+    size_type total_size;
+    allocator_type allocator;
+
+    template <typename List, typename Take>
+    void pack(List& list, Take take) {
+        if (list.empty()) return;
+        T* buffer = allocator_traits::allocate(allocator, list.size());
+        size_type constructed = 0;
+        try {
+            list.for_each_segment([&](auto segment) {
+                if constexpr (trivially_constructed) {
+                    std::memcpy(buffer + constructed, segment.data(),
+                                segment.size() * sizeof(T));
+                    constructed += segment.size();
+                } else {
+                    for (auto& value : segment) {
+                        allocator_traits::construct(
+                            allocator, buffer + constructed, take(value));
+                        ++constructed;
+                    }
+                }
+            });
+        } catch (...) {
+            destroy(buffer, constructed);
+            allocator_traits::deallocate(allocator, buffer, list.size());
+            throw;
+        }
+        elements = buffer;
+        total_size = constructed;
+    }
+
+    void destroy(T* buffer, size_type count) noexcept {
+        if constexpr (!trivially_destroyed) {
+            for (size_type i = 0; i < count; ++i) {
+                allocator_traits::destroy(allocator, buffer + i);
+            }
+        }
+    }
+
+    void release() noexcept {
+        if (!elements) return;
+        destroy(elements, total_size);
+        allocator_traits::deallocate(allocator, elements, total_size);
+        elements = nullptr;
+        total_size = 0;
+    }
+};
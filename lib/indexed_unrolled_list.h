@@ -0,0 +1,202 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename T, size_t NodeMaxSize = 10, typename KeyOf = std::identity,
+          typename Hash = std::hash<
+              std::remove_cvref_t<std::invoke_result_t<KeyOf, const T&>>>,
+          typename Allocator = std::allocator<T>>
+class indexed_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using key_type =
+        std::remove_cvref_t<std::invoke_result_t<KeyOf, const T&>>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = typename list_type::const_iterator;
+    using iterator = const_iterator;
+
+   private:
+    using Node = typename list_type::Node;
+
+    struct slot {
+        key_type key;
+        Node* node;
+    };
+
+    using slot_allocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<slot>;
+
+   public:
+    indexed_unrolled_list() : indexed_unrolled_list(Allocator()) {}
+    explicit indexed_unrolled_list(const allocator_type& alloc)
+        : list(alloc), slots(slot_allocator(alloc)) {}
+    indexed_unrolled_list(const indexed_unrolled_list&) = delete;
+    indexed_unrolled_list& operator=(const indexed_unrolled_list&) = delete;
+
+    std::pair<iterator, bool> push_back(const T& value) {
+        return insert(cend(), value);
+    }
+    std::pair<iterator, bool> push_front(const T& value) {
+        return insert(cbegin(), value);
+    }
+    std::pair<iterator, bool> insert(const_iterator pos, const T& value) {
+        const_iterator existing = find(key_of(value));
+        if (existing != cend()) return {existing, false};
+        reserve_slot();
+
+        Node* target = list_type::node_of(pos);
+        if (!target) target = list.tail;
+        bool splits = target && target->count == NodeMaxSize;
+
+        try {
+            iterator it = list.insert(pos, value);
+            Node* node = list_type::node_of(it);
+            if (splits) {
+                reindex(target->next);
+            }
+            upsert(key_of(*it), node);
+            return {it, true};
+        } catch (...) {
+            // The node may already be split, with its upper half still
+            // indexed under the old node.
+            if (splits && target->next) reindex(target->next);
+            throw;
+        }
+    }
+
+    iterator erase(const_iterator pos) {
+        unindex(key_of(*pos));
+        return list.erase(pos);
+    }
+    size_type erase(const key_type& key) {
+        const_iterator it = find(key);
+        if (it == cend()) return 0;
+        erase(it);
+        return 1;
+    }
+    void clear() noexcept {
+        list.clear();
+        slots.clear();
+        used = 0;
+        live = 0;
+    }
+
+    const_iterator find(const key_type& key) const {
+        const slot* s = lookup(key);
+        if (!s) return cend();
+        Node* node = s->node;
+        for (size_type i = 0; i < node->count; ++i) {
+            if (key_of(*node->elem(i)) == key) {
+                return const_iterator(node, i, &list);
+            }
+        }
+        return cend();
+    }
+    bool contains(const key_type& key) const { return lookup(key) != nullptr; }
+
+    const_iterator begin() const { return list.begin(); }
+    const_iterator cbegin() const { return list.cbegin(); }
+    const_iterator end() const { return list.end(); }
+    const_iterator cend() const { return list.cend(); }
+
+    bool empty() const { return list.empty(); }
+    size_type size() const { return list.size(); }
+    const list_type& items() const { return list; }
+    size_type index_bytes() const { return slots.capacity() * sizeof(slot); }
+
+   private:
+    static inline Node tombstone_node;
+    static constexpr Node* tombstone = &tombstone_node;
+
+    list_type list;
+    std::vector<slot, slot_allocator> slots;
+    size_type used = 0;
+    size_type live = 0;
+
+    static decltype(auto) key_of(const T& value) {
+        return std::invoke(KeyOf(), value);
+    }
+
+    size_type mask() const { return slots.size() - 1; }
+
+    // std::hash of an integer is often the identity, so strided keys would
+    // share their low bits. The murmur3 finalizer spreads every bit down.
+    size_type home(const key_type& key) const {
+        std::uint64_t h = Hash()(key);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return static_cast<size_type>(h) & mask();
+    }
+
+    const slot* lookup(const key_type& key) const {
+        if (slots.empty()) return nullptr;
+        for (size_type i = home(key);; i = (i + 1) & mask()) {
+            const slot& s = slots[i];
+            if (!s.node) return nullptr;
+            if (s.node != tombstone && s.key == key) return &s;
+        }
+    }
+
+    void upsert(const key_type& key, Node* node) {
+        slot* free_slot = nullptr;
+        for (size_type i = home(key);; i = (i + 1) & mask()) {
+            slot& s = slots[i];
+            if (!s.node) {
+                if (!free_slot) {
+                    free_slot = &s;
+                    ++used;
+                }
+                break;
+            }
+            if (s.node == tombstone) {
+                if (!free_slot) free_slot = &s;
+            } else if (s.key == key) {
+                s.node = node;
+                return;
+            }
+        }
+        free_slot->key = key;
+        free_slot->node = node;
+        ++live;
+    }
+
+    void unindex(const key_type& key) {
+        slot* s = const_cast<slot*>(lookup(key));
+        if (!s) return;
+        s->node = tombstone;
+        --live;
+    }
+
+    void reindex(Node* node) {
+        for (size_type i = 0; i < node->count; ++i) {
+            upsert(key_of(*node->elem(i)), node);
+        }
+    }
+
+    void reserve_slot() {
+        if ((used + 1) * 2 <= slots.size()) return;
+        size_type capacity = slots.empty() ? 16 : slots.size();
+        while ((live + 1) * 2 > capacity) capacity *= 2;
+        std::vector<slot, slot_allocator> rebuilt(
+            capacity, slot{key_type(), nullptr}, slots.get_allocator());
+        rebuilt.swap(slots);
+        used = live = 0;
+        for (Node* cur = list.head; cur; cur = cur->next) {
+            reindex(cur);
+        }
+    }
+};
@@ -0,0 +1,212 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <size_t BlockSize, size_t BlockAlign, size_t MagazineSize>
+class magazine_depot {
+   public:
+    struct block {
+        block* next;
+    };
+
+    struct magazine {
+        block* head = nullptr;
+        size_t count = 0;
+    };
+
+    static magazine_depot& instance() {
+        static magazine_depot depot;
+        return depot;
+    }
+
+    magazine_depot(const magazine_depot&) = delete;
+    magazine_depot& operator=(const magazine_depot&) = delete;
+    ~magazine_depot() {
+        for (magazine& m : full) {
+            free_chain(m.head);
+        }
+    }
+
+    magazine take() {
+        {
+            std::lock_guard lock(mutex);
+            if (!full.empty()) {
+                magazine m = full.back();
+                full.pop_back();
+                return m;
+            }
+        }
+        magazine m;
+        try {
+            for (; m.count < MagazineSize; ++m.count) {
+                block* b = allocate_block();
+                b->next = m.head;
+                m.head = b;
+            }
+        } catch (...) {
+            free_chain(m.head);
+            throw;
+        }
+        return m;
+    }
+
+    void put(magazine m) {
+        if (!m.head) return;
+        std::lock_guard lock(mutex);
+        full.push_back(m);
+    }
+
+    size_t magazines() const {
+        std::lock_guard lock(mutex);
+        return full.size();
+    }
+
+    static block* allocate_block() {
+        return static_cast<block*>(
+            ::operator new(block_size, std::align_val_t(block_align)));
+    }
+    static void free_block(block* b) noexcept {
+        ::operator delete(b, block_size, std::align_val_t(block_align));
+    }
+
+   private:
+    static constexpr size_t block_size = std::max(BlockSize, sizeof(block));
+    static constexpr size_t block_align = std::max(BlockAlign, alignof(block));
+
+    mutable std::mutex mutex;
+    std::vector<magazine> full;
+
+    magazine_depot() = default;
+
+    static void free_chain(block* b) noexcept {
+        while (b) {
+            block* next = b->next;
+            free_block(b);
+            b = next;
+        }
+    }
+};
+
+template <size_t BlockSize, size_t BlockAlign, size_t MagazineSize>
+class magazine_cache {
+   public:
+    using depot_type = magazine_depot<BlockSize, BlockAlign, MagazineSize>;
+    using block = typename depot_type::block;
+
+    static void* allocate() {
+        if (state_destroyed) return depot_type::allocate_block();
+        auto& cache = local();
+        if (!cache.loaded.head) {
+            cache.loaded = depot_type::instance().take();
+        }
+        block* b = cache.loaded.head;
+        cache.loaded.head = b->next;
+        --cache.loaded.count;
+        return b;
+    }
+
+    static void deallocate(void* p) noexcept {
+        block* b = static_cast<block*>(p);
+        if (state_destroyed) {
+            // The thread's cache is gone, so hand the block to the depot.
+            b->next = nullptr;
+            try {
+                depot_type::instance().put({b, 1});
+            } catch (...) {
+                depot_type::free_block(b);
+            }
+            return;
+        }
+        auto& cache = local();
+        b->next = cache.loaded.head;
+        cache.loaded.head = b;
+        if (++cache.loaded.count == 2 * MagazineSize) {
+            typename depot_type::magazine spilled{cache.loaded.head,
+                                                  MagazineSize};
+            block* last = cache.loaded.head;
+            for (size_t i = 1; i < MagazineSize; ++i) {
+                last = last->next;
+            }
+            cache.loaded.head = last->next;
+            cache.loaded.count -= MagazineSize;
+            last->next = nullptr;
+            try {
+                depot_type::instance().put(spilled);
+            } catch (...) {
+                last->next = cache.loaded.head;
+                cache.loaded.head = spilled.head;
+                cache.loaded.count += MagazineSize;
+            }
+        }
+    }
+
+   private:
+    struct thread_state {
+        typename depot_type::magazine loaded;
+
+        ~thread_state() {
+            state_destroyed = true;
+            try {
+                depot_type::instance().put(loaded);
+            } catch (...) {
+            }
+        }
+    };
+
+    // Trivially destructible, so it stays valid after thread_state is
+    // destroyed and guards other thread_local destructors that free blocks.
+    static inline thread_local bool state_destroyed = false;
+
+    static thread_state& local() {
+        static thread_local thread_state state;
+        return state;
+    }
+};
+
+template <typename U, size_t MagazineSize = 64>
+class magazine_allocator {
+   public:
+    using value_type = U;
+    using size_type = std::size_t;
+    using is_always_equal = std::true_type;
+
+    template <typename V>
+    struct rebind {
+        using other = magazine_allocator<V, MagazineSize>;
+    };
+
+    magazine_allocator() noexcept = default;
+    template <typename V>
+    magazine_allocator(const magazine_allocator<V, MagazineSize>&) noexcept {}
+
+    U* allocate(size_type n) {
+        if (n == 1) return static_cast<U*>(cache_type::allocate());
+        return std::allocator<U>().allocate(n);
+    }
+
+    void deallocate(U* p, size_type n) noexcept {
+        if (n == 1) {
+            cache_type::deallocate(p);
+            return;
+        }
+        std::allocator<U>().deallocate(p, n);
+    }
+
+    template <typename V>
+    bool operator==(const magazine_allocator<V, MagazineSize>&) const noexcept {
+        return true;
+    }
+    template <typename V>
+    bool operator!=(const magazine_allocator<V, MagazineSize>&) const noexcept {
+        return false;
+    }
+
+   private:
+    using cache_type = magazine_cache<sizeof(U), alignof(U), MagazineSize>;
+};
@@ -0,0 +1,166 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+template <typename T, size_t NodeMaxSize = 10>
+class node_arena;
+
+template <typename U, typename Arena>
+class arena_allocator {
+   public:
+    using value_type = U;
+    using size_type = std::size_t;
+    using is_always_equal = std::false_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit arena_allocator(Arena& arena) noexcept : arena(&arena) {}
+    template <typename V>
+    arena_allocator(const arena_allocator<V, Arena>& other) noexcept
+        : arena(other.arena) {}
+
+    U* allocate(size_type n) {
+        if constexpr (std::is_same_v<U, typename Arena::node_type>) {
+            if (n == 1) return arena->allocate();
+        }
+        return std::allocator<U>().allocate(n);
+    }
+
+    void deallocate(U* p, size_type n) noexcept {
+        if constexpr (std::is_same_v<U, typename Arena::node_type>) {
+            if (n == 1) {
+                arena->deallocate(p);
+                return;
+            }
+        }
+        std::allocator<U>().deallocate(p, n);
+    }
+
+    void deallocate_chain(U* first, U* last, size_type count) noexcept
+        requires std::is_same_v<U, typename Arena::node_type>
+    {
+        arena->deallocate_chain(first, last, count);
+    }
+
+    Arena& get_arena() const noexcept { return *arena; }
+
+    template <typename V>
+    bool operator==(const arena_allocator<V, Arena>& other) const noexcept {
+        return arena == other.arena;
+    }
+    template <typename V>
+    bool operator!=(const arena_allocator<V, Arena>& other) const noexcept {
+        return !(*this == other);
+    }
+
+   private:
+    Arena* arena;
+
+    template <typename, typename>
+    friend class arena_allocator;
+};
+
+template <typename T, size_t NodeMaxSize>
+class node_arena {
+   public:
+    using node_type = unrolled_list_node<T, NodeMaxSize>;
+    using allocator_type = arena_allocator<T, node_arena>;
+    using list_type = unrolled_list<T, NodeMaxSize, allocator_type>;
+    using size_type = std::size_t;
+
+    explicit node_arena(size_type nodes_per_slab = 256)
+        : nodes_per_slab(std::max<size_type>(nodes_per_slab, 1)) {}
+    node_arena(const node_arena&) = delete;
+    node_arena& operator=(const node_arena&) = delete;
+    ~node_arena() { free_slabs(); }
+
+    allocator_type get_allocator() noexcept { return allocator_type(*this); }
+    list_type make_list() { return list_type(get_allocator()); }
+
+    node_type* allocate() {
+        if (free_list) {
+            node_type* p = free_list;
+            free_list = free_list->next;
+            ++live_nodes;
+            return p;
+        }
+        if (cursor == slab_end) {
+            add_slab();
+        }
+        ++live_nodes;
+        return cursor++;
+    }
+
+    void deallocate(node_type* p) noexcept {
+        p->next = free_list;
+        free_list = p;
+        --live_nodes;
+    }
+
+    void deallocate_chain(node_type* first, node_type* last,
+                          size_type count) noexcept {
+        last->next = free_list;
+        free_list = first;
+        live_nodes -= count;
+    }
+
+    // Frees every slab at once, together with the nodes of every list built
+    // on the arena. Elements are not destroyed, and such lists must be
+    // abandon()ed before they are used or destroyed again.
+    void release() noexcept { free_slabs(); }
+
+    size_type slabs_allocated() const noexcept { return slab_count; }
+    size_type nodes_in_use() const noexcept { return live_nodes; }
+    size_type capacity() const noexcept { return slab_count * nodes_per_slab; }
+
+   private:
+    struct slab_header {
+        slab_header* next;
+    };
+
+    static constexpr std::align_val_t slab_alignment{
+        std::max(alignof(node_type), alignof(slab_header))};
+    static constexpr size_type nodes_offset =
+        (sizeof(slab_header) + alignof(node_type) - 1) / alignof(node_type) *
+        alignof(node_type);
+
+    size_type nodes_per_slab;
+    slab_header* slabs = nullptr;
+    node_type* free_list = nullptr;
+    node_type* cursor = nullptr;
+    node_type* slab_end = nullptr;
+    size_type slab_count = 0;
+    size_type live_nodes = 0;
+
+    size_type slab_bytes() const noexcept {
+        return nodes_offset + nodes_per_slab * sizeof(node_type);
+    }
+
+    void free_slabs() noexcept {
+        while (slabs) {
+            slab_header* next = slabs->next;
+            ::operator delete(slabs, slab_bytes(), slab_alignment);
+            slabs = next;
+        }
+        free_list = cursor = slab_end = nullptr;
+        slab_count = 0;
+        live_nodes = 0;
+    }
+
+    void add_slab() {
+        auto* slab = static_cast<slab_header*>(
+            ::operator new(slab_bytes(), slab_alignment));
+        slab->next = slabs;
+        slabs = slab;
+        ++slab_count;
+        cursor = reinterpret_cast<node_type*>(
+            reinterpret_cast<std::byte*>(slab) + nodes_offset);
+        slab_end = cursor + nodes_per_slab;
+    }
+};
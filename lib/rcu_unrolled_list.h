@@ -0,0 +1,106 @@
+#pragma once
+#include <epoch_domain.h>
+#include <unrolled_list.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class rcu_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using size_type = typename list_type::size_type;
+
+    class reader;
+
+    class snapshot {
+       public:
+        snapshot(const snapshot&) = delete;
+        snapshot& operator=(const snapshot&) = delete;
+
+        const list_type& operator*() const { return *list; }
+        const list_type* operator->() const { return list; }
+        const list_type* get() const { return list; }
+
+       private:
+        epoch_domain::guard pin;
+        const list_type* list;
+
+        snapshot(epoch_domain::guard pin, const list_type* list)
+            : pin(std::move(pin)), list(list) {}
+
+        friend class reader;
+    };
+
+    class reader {
+       public:
+        snapshot read() const {
+            epoch_domain::guard pin = participant.pin();
+            return snapshot(std::move(pin),
+                            owner->current.load(std::memory_order_seq_cst));
+        }
+
+       private:
+        const rcu_unrolled_list* owner;
+        epoch_domain::participant participant;
+
+        reader(const rcu_unrolled_list* owner,
+               epoch_domain::participant participant)
+            : owner(owner), participant(std::move(participant)) {}
+
+        friend class rcu_unrolled_list;
+    };
+
+    rcu_unrolled_list()
+        : current(new list_type()), writer(domain.register_thread()) {}
+    explicit rcu_unrolled_list(list_type initial)
+        : current(new list_type(std::move(initial))),
+          writer(domain.register_thread()) {}
+    rcu_unrolled_list(const rcu_unrolled_list&) = delete;
+    rcu_unrolled_list& operator=(const rcu_unrolled_list&) = delete;
+    ~rcu_unrolled_list() { delete current.load(std::memory_order_relaxed); }
+
+    reader make_reader() { return reader(this, domain.register_thread()); }
+
+    template <typename F>
+    void update(F f) {
+        std::lock_guard lock(writer_mutex);
+        auto next = std::make_unique<list_type>(
+            *current.load(std::memory_order_relaxed));
+        f(*next);
+        publish_locked(std::move(next));
+    }
+
+    void publish(list_type next) {
+        auto published = std::make_unique<list_type>(std::move(next));
+        std::lock_guard lock(writer_mutex);
+        publish_locked(std::move(published));
+    }
+
+    void reclaim() {
+        std::lock_guard lock(writer_mutex);
+        writer.reclaim();
+    }
+
+    size_type pending_reclaim() const {
+        std::lock_guard lock(writer_mutex);
+        return writer.pending();
+    }
+
+   private:
+    std::atomic<const list_type*> current;
+    epoch_domain domain;
+    epoch_domain::participant writer;
+    mutable std::mutex writer_mutex;
+
+    void publish_locked(std::unique_ptr<list_type> next) {
+        writer.reserve(1);
+        const list_type* old =
+            current.exchange(next.release(), std::memory_order_seq_cst);
+        writer.retire(const_cast<list_type*>(old));
+        writer.reclaim();
+    }
+};
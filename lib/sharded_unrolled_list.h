@@ -0,0 +1,153 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class sharded_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+
+   private:
+    struct alignas(64) shard {
+        mutable std::mutex mutex;
+        list_type list;
+
+        explicit shard(const allocator_type& alloc) : list(alloc) {}
+    };
+
+   public:
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return &*current; }
+        const_iterator& operator++() {
+            ++current;
+            skip_empty();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const {
+            return index == other.index &&
+                   (index == shards->size() || current == other.current);
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+       private:
+        const std::vector<std::unique_ptr<shard>>* shards;
+        size_type index;
+        typename list_type::const_iterator current;
+
+        const_iterator(const std::vector<std::unique_ptr<shard>>* shards,
+                       size_type index)
+            : shards(shards),
+              index(index),
+              current(nullptr, 0, nullptr) {
+            if (index < shards->size()) {
+                current = (*shards)[index]->list.cbegin();
+                skip_empty();
+            }
+        }
+
+        void skip_empty() {
+            while (current == (*shards)[index]->list.cend()) {
+                if (++index == shards->size()) return;
+                current = (*shards)[index]->list.cbegin();
+            }
+        }
+
+        friend class sharded_unrolled_list;
+    };
+
+    explicit sharded_unrolled_list(
+        size_type shard_count = std::thread::hardware_concurrency(),
+        const allocator_type& alloc = allocator_type())
+        : allocator(alloc) {
+        if (shard_count == 0) shard_count = 1;
+        shards.reserve(shard_count);
+        for (size_type i = 0; i < shard_count; ++i) {
+            shards.push_back(std::make_unique<shard>(allocator));
+        }
+    }
+    sharded_unrolled_list(const sharded_unrolled_list&) = delete;
+    sharded_unrolled_list& operator=(const sharded_unrolled_list&) = delete;
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        shard& local = local_shard();
+        std::lock_guard lock(local.mutex);
+        local.list.emplace_back(std::forward<Args>(args)...);
+    }
+
+    size_type size() const {
+        size_type total = 0;
+        for (const auto& s : shards) {
+            std::lock_guard lock(s->mutex);
+            total += s->list.size();
+        }
+        return total;
+    }
+    bool empty() const { return size() == 0; }
+    size_type shard_count() const { return shards.size(); }
+
+    template <typename F>
+    void for_each(F f) const {
+        for (const auto& s : shards) {
+            std::lock_guard lock(s->mutex);
+            for (const T& value : s->list) {
+                f(value);
+            }
+        }
+    }
+
+    const_iterator begin() const { return const_iterator(&shards, 0); }
+    const_iterator end() const {
+        return const_iterator(&shards, shards.size());
+    }
+
+    list_type collapse() {
+        list_type result(allocator);
+        for (auto& s : shards) {
+            std::lock_guard lock(s->mutex);
+            result.splice(result.cend(), s->list);
+        }
+        return result;
+    }
+
+   private:
+    allocator_type allocator;
+    std::vector<std::unique_ptr<shard>> shards;
+
+    shard& local_shard() {
+        static std::atomic<size_type> next_slot{0};
+        static thread_local size_type slot =
+            next_slot.fetch_add(1, std::memory_order_relaxed);
+        return *shards[slot % shards.size()];
+    }
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+template <typename T, typename Op, size_t NodeMaxSize = 32,
+          typename Allocator = std::allocator<T>>
+class sliding_window_aggregator {
+    struct entry {
+        T value;
+        T aggregate;
+    };
+
+   public:
+    using list_type = unrolled_list<
+        entry, NodeMaxSize,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            entry>>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+
+    explicit sliding_window_aggregator(
+        Op op = Op(), const allocator_type& alloc = Allocator())
+        : list(typename list_type::allocator_type(alloc)), op(std::move(op)) {}
+    sliding_window_aggregator(const sliding_window_aggregator&) = delete;
+    sliding_window_aggregator& operator=(const sliding_window_aggregator&) =
+        delete;
+
+    void push_back(const T& value) {
+        T aggregate = back_aggregate ? op(*back_aggregate, value) : value;
+        list.append_value(entry{value, value});
+        back_aggregate = std::move(aggregate);
+    }
+    void pop_front() {
+        if (front_count == 0) flip();
+        --front_count;
+        if (++head_offset == list.head->count) {
+            list.retain_node(list.detach_head());
+            head_offset = 0;
+        }
+    }
+    void clear() noexcept {
+        list.reset();
+        head_offset = 0;
+        front_count = 0;
+        back_aggregate.reset();
+    }
+
+    T aggregate() const {
+        if (empty()) throw std::out_of_range("Window is empty");
+        if (front_count == 0) return *back_aggregate;
+        const T& front = list.head->elem(head_offset)->aggregate;
+        return back_aggregate ? op(front, *back_aggregate) : front;
+    }
+    const_reference front() const {
+        if (empty()) throw std::out_of_range("Window is empty");
+        return list.head->elem(head_offset)->value;
+    }
+    const_reference back() const {
+        if (empty()) throw std::out_of_range("Window is empty");
+        return list.back().value;
+    }
+
+    bool empty() const { return size() == 0; }
+    size_type size() const { return list.size() - head_offset; }
+
+   private:
+    using Node = typename list_type::Node;
+
+    list_type list;
+    [[no_unique_address]] Op op;
+    size_type head_offset = 0;
+    size_type front_count = 0;
+    std::optional<T> back_aggregate;
+
+    void flip() {
+        std::optional<T> suffix;
+        for (Node* node = list.tail; node; node = node->prev) {
+            size_type first = node == list.head ? head_offset : 0;
+            for (size_type i = node->count; i-- > first;) {
+                entry& e = *node->elem(i);
+                suffix = suffix ? op(e.value, *suffix) : e.value;
+                e.aggregate = *suffix;
+            }
+        }
+        front_count = size();
+        back_aggregate.reset();
+    }
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 32,
+          typename TimeOf = std::identity,
+          typename Allocator = std::allocator<T>>
+class time_series_unrolled_list {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using time_type =
+        std::remove_cvref_t<std::invoke_result_t<TimeOf, const T&>>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator = typename list_type::const_iterator;
+    using iterator = const_iterator;
+
+   private:
+    using Node = typename list_type::Node;
+
+    struct node_range {
+        Node* node;
+        time_type min;
+        time_type max;
+    };
+
+    using range_allocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<node_range>;
+
+   public:
+    time_series_unrolled_list() : time_series_unrolled_list(Allocator()) {}
+    explicit time_series_unrolled_list(const allocator_type& alloc)
+        : list(alloc), ranges(range_allocator(alloc)) {}
+    time_series_unrolled_list(const time_series_unrolled_list&) = delete;
+    time_series_unrolled_list& operator=(const time_series_unrolled_list&) =
+        delete;
+
+    void push_back(const T& value) { append(value); }
+    void push_back(T&& value) { append(std::move(value)); }
+
+    const_iterator seek(const time_type& time) const {
+        auto covers = [&](const node_range& r) { return !(r.max < time); };
+        auto found = ordered ? std::partition_point(
+                                   ranges.begin(), ranges.end(),
+                                   std::not_fn(covers))
+                             : std::find_if(ranges.begin(), ranges.end(),
+                                            covers);
+        if (found == ranges.end()) return cend();
+        Node* node = found->node;
+        auto older = [&](const T& value) { return time_of(value) < time; };
+        const T* first = node->elem(0);
+        const T* last = first + node->count;
+        const T* point = ordered ? std::partition_point(first, last, older)
+                                 : std::find_if_not(first, last, older);
+        return const_iterator(node, point - first, &list);
+    }
+
+    size_type expire_before(const time_type& time) {
+        size_type expired = 0;
+        while (!ranges.empty() && ranges.front().max < time) {
+            expired += list.head->count;
+            list.destroy_node(list.detach_head());
+            ranges.pop_front();
+        }
+        if (ranges.empty()) {
+            ordered = true;
+            return expired;
+        }
+        if (!(ranges.front().min < time)) return expired;
+
+        // The boundary node keeps at least one element, so it is trimmed in
+        // place rather than through erase, which may free it.
+        Node* node = list.head;
+        size_type trimmed = 0;
+        while (time_of(*node->elem(trimmed)) < time) ++trimmed;
+        list.destroy_elements(node, 0, trimmed);
+        list.normalize_node(node, trimmed, trimmed);
+        node->count -= trimmed;
+        list.total_size -= trimmed;
+        node_range& boundary = ranges.front();
+        boundary.min = time_of(*node->elem(0));
+        for (size_type i = 1; i < node->count; ++i) {
+            boundary.min = std::min(boundary.min, time_of(*node->elem(i)));
+        }
+        return expired + trimmed;
+    }
+    void clear() noexcept {
+        list.clear();
+        ranges.clear();
+        ordered = true;
+    }
+
+    const_reference front() const { return list.front(); }
+    const_reference back() const { return list.back(); }
+
+    const_iterator begin() const { return list.begin(); }
+    const_iterator cbegin() const { return list.cbegin(); }
+    const_iterator end() const { return list.end(); }
+    const_iterator cend() const { return list.cend(); }
+
+    bool empty() const { return list.empty(); }
+    size_type size() const { return list.size(); }
+    size_type node_count() const { return ranges.size(); }
+    bool is_ordered() const { return ordered; }
+    const list_type& items() const { return list; }
+
+   private:
+    list_type list;
+    std::deque<node_range, range_allocator> ranges;
+    bool ordered = true;
+
+    static decltype(auto) time_of(const T& value) {
+        return std::invoke(TimeOf(), value);
+    }
+
+    template <typename V>
+    void append(V&& value) {
+        time_type time = time_of(value);
+        if (list.tail && list.tail->count < NodeMaxSize) {
+            list.append_value(std::forward<V>(value));
+            node_range& last = ranges.back();
+            ordered = ordered && !(time < last.max);
+            last.min = std::min(last.min, time);
+            last.max = std::max(last.max, time);
+            return;
+        }
+        ranges.push_back({nullptr, time, time});
+        try {
+            list.append_value(std::forward<V>(value));
+        } catch (...) {
+            ranges.pop_back();
+            throw;
+        }
+        ranges.back().node = list.tail;
+        if (ranges.size() > 1) {
+            ordered = ordered && !(time < ranges[ranges.size() - 2].max);
+        }
+    }
+};
@@ -0,0 +1,385 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+template <typename T, size_t NodeMaxSize>
+struct unrolled_hash_set_node {
+    static constexpr std::size_t tag_capacity = (NodeMaxSize + 15) / 16 * 16;
+
+    std::size_t count;
+    unrolled_hash_set_node* next;
+    alignas(16) std::uint8_t tags[tag_capacity];
+    alignas(T) std::byte data[sizeof(T) * NodeMaxSize];
+
+    unrolled_hash_set_node() : count(0), next(nullptr), tags{} {}
+
+    T* elem(std::size_t index) { return &reinterpret_cast<T*>(data)[index]; }
+    const T* elem(std::size_t index) const {
+        return &reinterpret_cast<const T*>(data)[index];
+    }
+};
+
+template <typename T, size_t NodeMaxSize = 16, typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>,
+          typename Allocator = std::allocator<T>>
+class unrolled_hash_set {
+   public:
+    using key_type = T;
+    using value_type = T;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const T&;
+
+   private:
+    using Node = unrolled_hash_set_node<T, NodeMaxSize>;
+    using node_allocator =
+        typename allocator_traits::template rebind_alloc<Node>;
+    using node_allocator_traits = std::allocator_traits<node_allocator>;
+    using bucket_allocator =
+        typename allocator_traits::template rebind_alloc<Node*>;
+
+   public:
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+
+        const_iterator() : node(nullptr), index(0), bucket(0), set(nullptr) {}
+
+        reference operator*() const { return *node->elem(index); }
+        pointer operator->() const { return node->elem(index); }
+        const_iterator& operator++() {
+            if (++index == node->count) {
+                index = 0;
+                node = node->next;
+                if (!node) skip_to_bucket(bucket + 1);
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const {
+            return node == other.node && index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+       private:
+        const Node* node;
+        size_type index;
+        size_type bucket;
+        const unrolled_hash_set* set;
+
+        const_iterator(const Node* node, size_type index, size_type bucket,
+                       const unrolled_hash_set* set)
+            : node(node), index(index), bucket(bucket), set(set) {}
+
+        void skip_to_bucket(size_type from) {
+            for (bucket = from; bucket < set->buckets.size(); ++bucket) {
+                if (set->buckets[bucket]) {
+                    node = set->buckets[bucket];
+                    return;
+                }
+            }
+            node = nullptr;
+        }
+
+        friend class unrolled_hash_set;
+    };
+    using iterator = const_iterator;
+
+    unrolled_hash_set() : unrolled_hash_set(Allocator()) {}
+    explicit unrolled_hash_set(const allocator_type& alloc)
+        : allocator(alloc),
+          node_alloc(allocator),
+          buckets(bucket_allocator(allocator)) {}
+    unrolled_hash_set(std::initializer_list<T> ilist,
+                      const allocator_type& alloc = Allocator())
+        : unrolled_hash_set(alloc) {
+        for (const T& value : ilist) {
+            insert(value);
+        }
+    }
+    unrolled_hash_set(const unrolled_hash_set&) = delete;
+    unrolled_hash_set& operator=(const unrolled_hash_set&) = delete;
+    ~unrolled_hash_set() { clear(); }
+
+    std::pair<iterator, bool> insert(const T& value) {
+        return insert_value(value);
+    }
+    std::pair<iterator, bool> insert(T&& value) {
+        return insert_value(std::move(value));
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        return insert_value(std::move(value));
+    }
+
+    const_iterator find(const T& key) const {
+        if (buckets.empty()) return end();
+        return find_hashed(key, hash_of(key));
+    }
+    bool contains(const T& key) const { return find(key) != end(); }
+    size_type count(const T& key) const { return contains(key); }
+
+    size_type erase(const T& key) {
+        if (buckets.empty()) return 0;
+        std::size_t hash = hash_of(key);
+        Node** link = &buckets[hash & (buckets.size() - 1)];
+        std::uint8_t tag = tag_of(hash);
+        for (Node* node = *link; node; link = &node->next, node = *link) {
+            size_type index = match(node, tag, key);
+            if (index == NodeMaxSize) continue;
+
+            size_type last = node->count - 1;
+            allocator_traits::destroy(allocator, node->elem(index));
+            if (index != last) {
+                allocator_traits::construct(allocator, node->elem(index),
+                                            std::move(*node->elem(last)));
+                allocator_traits::destroy(allocator, node->elem(last));
+                node->tags[index] = node->tags[last];
+            }
+            node->count = last;
+            if (last == 0) {
+                *link = node->next;
+                destroy_node(node);
+            }
+            --total_size;
+            return 1;
+        }
+        return 0;
+    }
+
+    void clear() noexcept {
+        for (Node*& head : buckets) {
+            while (head) {
+                Node* next = head->next;
+                destroy_node(head);
+                head = next;
+            }
+        }
+        total_size = 0;
+    }
+
+    void reserve(size_type count) {
+        size_type wanted = 8;
+        while (wanted * max_load < count) wanted *= 2;
+        if (wanted > buckets.size()) rehash(wanted);
+    }
+
+    const_iterator begin() const {
+        const_iterator it(nullptr, 0, 0, this);
+        it.skip_to_bucket(0);
+        return it;
+    }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return total_size == 0; }
+    size_type size() const { return total_size; }
+    size_type bucket_count() const { return buckets.size(); }
+    size_type node_count() const { return nodes; }
+    float load_factor() const {
+        return buckets.empty() ? 0.0f
+                               : static_cast<float>(total_size) /
+                                     static_cast<float>(buckets.size());
+    }
+    float max_load_factor() const { return max_load; }
+    void max_load_factor(float load) { max_load = load; }
+    size_type memory_usage() const {
+        return buckets.capacity() * sizeof(Node*) + nodes * sizeof(Node);
+    }
+
+   private:
+    allocator_type allocator;
+    node_allocator node_alloc;
+    std::vector<Node*, bucket_allocator> buckets;
+    size_type total_size = 0;
+    size_type nodes = 0;
+    float max_load = 4.0f;
+
+    // std::hash of an integer is often the identity, so the hash goes
+    // through the murmur3 finalizer: the bucket takes its low bits and the
+    // fingerprint its top byte, and both then depend on every input bit.
+    static std::size_t hash_of(const T& key) {
+        std::uint64_t h = hasher()(key);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+    static std::uint8_t tag_of(std::size_t hash) {
+        return static_cast<std::uint8_t>(
+            static_cast<std::uint64_t>(hash) >> 56);
+    }
+
+    size_type match(const Node* node, std::uint8_t tag, const T& key) const {
+#if defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(tag));
+        for (size_type base = 0; base < node->count; base += 16) {
+            __m128i tags = _mm_load_si128(
+                reinterpret_cast<const __m128i*>(node->tags + base));
+            unsigned mask = static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(tags, needle)));
+            if (node->count - base < 16) {
+                mask &= (1u << (node->count - base)) - 1;
+            }
+            while (mask) {
+                size_type index = base + __builtin_ctz(mask);
+                if (key_equal()(*node->elem(index), key)) return index;
+                mask &= mask - 1;
+            }
+        }
+#else
+        for (size_type index = 0; index < node->count; ++index) {
+            if (node->tags[index] == tag &&
+                key_equal()(*node->elem(index), key)) {
+                return index;
+            }
+        }
+#endif
+        return NodeMaxSize;
+    }
+
+    const_iterator find_hashed(const T& key, std::size_t hash) const {
+        size_type bucket = hash & (buckets.size() - 1);
+        std::uint8_t tag = tag_of(hash);
+        for (const Node* node = buckets[bucket]; node; node = node->next) {
+            size_type index = match(node, tag, key);
+            if (index != NodeMaxSize) {
+                return const_iterator(node, index, bucket, this);
+            }
+        }
+        return end();
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_value(V&& value) {
+        std::size_t hash = hash_of(value);
+        if (!buckets.empty()) {
+            iterator existing = find_hashed(value, hash);
+            if (existing != end()) return {existing, false};
+        }
+        if (total_size + 1 > max_load * buckets.size()) {
+            rehash(buckets.empty() ? 8 : buckets.size() * 2);
+        }
+
+        size_type bucket = hash & (buckets.size() - 1);
+        Node* target = buckets[bucket];
+        while (target && target->count == NodeMaxSize) target = target->next;
+        if (!target) {
+            target = create_node();
+            try {
+                allocator_traits::construct(allocator, target->elem(0),
+                                            std::forward<V>(value));
+            } catch (...) {
+                deallocate_node(target);
+                throw;
+            }
+            target->next = buckets[bucket];
+            buckets[bucket] = target;
+        } else {
+            allocator_traits::construct(allocator,
+                                        target->elem(target->count),
+                                        std::forward<V>(value));
+        }
+        size_type index = target->count++;
+        target->tags[index] = tag_of(hash);
+        ++total_size;
+        return {const_iterator(target, index, bucket, this), true};
+    }
+
+    void rehash(size_type bucket_count) {
+        std::vector<Node*, bucket_allocator> previous(
+            bucket_count, nullptr, buckets.get_allocator());
+        previous.swap(buckets);
+        size_type placed = 0;
+        try {
+            for (Node*& head : previous) {
+                while (head) {
+                    Node* next = head->next;
+                    for (size_type i = 0; i < head->count; ++i) {
+                        place(std::move(*head->elem(i)));
+                        ++placed;
+                    }
+                    destroy_node(head);
+                    head = next;
+                }
+            }
+        } catch (...) {
+            for (Node* head : previous) {
+                while (head) {
+                    Node* next = head->next;
+                    destroy_node(head);
+                    head = next;
+                }
+            }
+            total_size = placed;
+            throw;
+        }
+    }
+
+    void place(T&& value) {
+        std::size_t hash = hash_of(value);
+        Node*& head = buckets[hash & (buckets.size() - 1)];
+        if (!head || head->count == NodeMaxSize) {
+            Node* node = create_node();
+            try {
+                allocator_traits::construct(allocator, node->elem(0),
+                                            std::move(value));
+            } catch (...) {
+                deallocate_node(node);
+                throw;
+            }
+            node->next = head;
+            head = node;
+        } else {
+            allocator_traits::construct(allocator, head->elem(head->count),
+                                        std::move(value));
+        }
+        head->tags[head->count++] = tag_of(hash);
+    }
+
+    Node* create_node() {
+        Node* p = node_allocator_traits::allocate(node_alloc, 1);
+        node_allocator_traits::construct(node_alloc, p);
+        ++nodes;
+        return p;
+    }
+    void deallocate_node(Node* p) noexcept {
+        node_allocator_traits::destroy(node_alloc, p);
+        node_allocator_traits::deallocate(node_alloc, p, 1);
+        --nodes;
+    }
+    void destroy_node(Node* p) noexcept {
+        for (size_type i = 0; i < p->count; ++i) {
+            allocator_traits::destroy(allocator, p->elem(i));
+        }
+        deallocate_node(p);
+    }
+};
@@ -1,13 +1,49 @@
 #pragma once
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+template <typename T, size_t NodeMaxSize>
+struct unrolled_list_node {
+    std::size_t count;
+    unrolled_list_node* next;
+    unrolled_list_node* prev;
+    alignas(T) std::byte data[sizeof(T) * NodeMaxSize];
+
+    unrolled_list_node() : count(0), next(nullptr), prev(nullptr) {}
+
+    T* elem(std::size_t index) { return &reinterpret_cast<T*>(data)[index]; }
+    const T* elem(std::size_t index) const {
+        return &reinterpret_cast<const T*>(data)[index];
+    }
+};
+
+template <typename T, size_t NodeMaxSize, typename Allocator>
+class frozen_unrolled_list;
+
+template <typename T, size_t NodeMaxSize, typename KeyOf, typename Hash,
+          typename Allocator>
+class indexed_unrolled_list;
+
+template <typename T, size_t NodeMaxSize, typename Allocator>
+class bounded_unrolled_list;
+
+template <typename T, typename Op, size_t NodeMaxSize, typename Allocator>
+class sliding_window_aggregator;
+
+template <typename T, size_t NodeMaxSize, typename TimeOf, typename Allocator>
+class time_series_unrolled_list;
 
 template <typename T, size_t NodeMaxSize = 10,
           typename Allocator = std::allocator<T>>
@@ -22,27 +58,7 @@ class unrolled_list {
     using difference_type = std::ptrdiff_t;
 
    private:
-    struct Node {
-        size_type count;
-        Node* next;
-        Node* prev;
-        allocator_type& allocator;
-        alignas(T) std::byte data[sizeof(T) * NodeMaxSize];
-
-        explicit Node(allocator_type& alloc)
-            : count(0), next(nullptr), prev(nullptr), allocator(alloc) {}
-
-        T* elem(size_type index) { return &reinterpret_cast<T*>(data)[index]; }
-        const T* elem(size_type index) const {
-            return &reinterpret_cast<const T*>(data)[index];
-        }
-
-        ~Node() {
-            for (size_type i = 0; i < count; ++i) {
-                allocator_traits::destroy(allocator, elem(i));
-            }
-        }
-    };
+    using Node = unrolled_list_node<T, NodeMaxSize>;
 
    public:
     using node_allocator =
@@ -59,19 +75,31 @@ class unrolled_list {
         using difference_type = std::ptrdiff_t;
 
         iterator(Node* node, size_type index, const unrolled_list* parent)
-            : current_node(node), index_in_node(index), parent(parent) {}
-
-        reference operator*() const {
-            return *current_node->elem(index_in_node);
+            : current_node(node),
+              current(nullptr),
+              node_end(nullptr),
+              parent(parent) {
+            if (current_node && index == current_node->count) {
+                current_node = current_node->next;
+                index = 0;
+            }
+            if (current_node) {
+                current = current_node->elem(index);
+                node_end = current_node->elem(current_node->count);
+            }
         }
-        pointer operator->() const { return current_node->elem(index_in_node); }
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
         iterator& operator++() {
-            if (!current_node) return *this;
-            if (index_in_node < current_node->count - 1)
-                ++index_in_node;
-            else {
+            if (++current == node_end) {
                 current_node = current_node->next;
-                index_in_node = 0;
+                if (current_node) {
+                    current = current_node->elem(0);
+                    node_end = current + current_node->count;
+                } else {
+                    current = node_end = nullptr;
+                }
             }
             return *this;
         }
@@ -83,13 +111,13 @@ class unrolled_list {
         iterator& operator--() {
             if (!current_node) {
                 current_node = parent->tail;
-                if (current_node) index_in_node = current_node->count - 1;
-            } else if (index_in_node > 0)
-                --index_in_node;
-            else {
+                if (!current_node) return *this;
+                current = node_end = current_node->elem(current_node->count);
+            } else if (current == current_node->elem(0)) {
                 current_node = current_node->prev;
-                if (current_node) index_in_node = current_node->count - 1;
+                current = node_end = current_node->elem(current_node->count);
             }
+            --current;
             return *this;
         }
         iterator operator--(int) {
@@ -98,8 +126,7 @@ class unrolled_list {
             return tmp;
         }
         bool operator==(const iterator& other) const {
-            return current_node == other.current_node &&
-                   index_in_node == other.index_in_node;
+            return current == other.current;
         }
         bool operator!=(const iterator& other) const {
             return !(*this == other);
@@ -107,8 +134,14 @@ class unrolled_list {
 
        private:
         Node* current_node;
-        size_type index_in_node;
+        T* current;
+        T* node_end;
         const unrolled_list* parent;
+
+        size_type index_in_node() const {
+            return current_node ? current - current_node->elem(0) : 0;
+        }
+
         friend class const_iterator;
         friend class unrolled_list;
     };
@@ -122,23 +155,36 @@ class unrolled_list {
         using difference_type = std::ptrdiff_t;
 
         const_iterator(Node* node, size_type index, const unrolled_list* parent)
-            : current_node(node), index_in_node(index), parent(parent) {}
+            : current_node(node),
+              current(nullptr),
+              node_end(nullptr),
+              parent(parent) {
+            if (current_node && index == current_node->count) {
+                current_node = current_node->next;
+                index = 0;
+            }
+            if (current_node) {
+                current = current_node->elem(index);
+                node_end = current_node->elem(current_node->count);
+            }
+        }
         const_iterator(const iterator& it)
             : current_node(it.current_node),
-              index_in_node(it.index_in_node),
+              current(it.current),
+              node_end(it.node_end),
               parent(it.parent) {}
 
-        reference operator*() const {
-            return *current_node->elem(index_in_node);
-        }
-        pointer operator->() const { return current_node->elem(index_in_node); }
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
         const_iterator& operator++() {
-            if (!current_node) return *this;
-            if (index_in_node < current_node->count - 1)
-                ++index_in_node;
-            else {
+            if (++current == node_end) {
                 current_node = current_node->next;
-                index_in_node = 0;
+                if (current_node) {
+                    current = current_node->elem(0);
+                    node_end = current + current_node->count;
+                } else {
+                    current = node_end = nullptr;
+                }
             }
             return *this;
         }
@@ -150,13 +196,13 @@ class unrolled_list {
         const_iterator& operator--() {
             if (!current_node) {
                 current_node = parent->tail;
-                if (current_node) index_in_node = current_node->count - 1;
-            } else if (index_in_node > 0)
-                --index_in_node;
-            else {
+                if (!current_node) return *this;
+                current = node_end = current_node->elem(current_node->count);
+            } else if (current == current_node->elem(0)) {
                 current_node = current_node->prev;
-                if (current_node) index_in_node = current_node->count - 1;
+                current = node_end = current_node->elem(current_node->count);
             }
+            --current;
             return *this;
         }
         const_iterator operator--(int) {
@@ -165,8 +211,7 @@ class unrolled_list {
             return tmp;
         }
         bool operator==(const const_iterator& other) const {
-            return current_node == other.current_node &&
-                   index_in_node == other.index_in_node;
+            return current == other.current;
         }
         bool operator!=(const const_iterator& other) const {
             return !(*this == other);
@@ -174,13 +219,208 @@ class unrolled_list {
 
        private:
         Node* current_node;
-        size_type index_in_node;
+        const T* current;
+        const T* node_end;
         const unrolled_list* parent;
+
+        size_type index_in_node() const {
+            return current_node ? current - current_node->elem(0) : 0;
+        }
+
         friend class unrolled_list;
     };
 
-    using reverse_iterator = std::reverse_iterator<iterator>;
-    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    class const_reverse_iterator;
+    class reverse_iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using reference = T&;
+        using pointer = T*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_type = iterator;
+
+        reverse_iterator(Node* node, size_type index,
+                         const unrolled_list* parent)
+            : current_node(node),
+              current(node ? node->elem(index) : nullptr),
+              node_begin(node ? node->elem(0) : nullptr),
+              parent(parent) {}
+        explicit reverse_iterator(const iterator& it)
+            : reverse_iterator(it.current_node, 0, it.parent) {
+            if (!current_node) {
+                current_node = parent->tail;
+                if (!current_node) return;
+                node_begin = current_node->elem(0);
+                current = current_node->elem(current_node->count);
+            } else if (it.current == node_begin) {
+                current_node = current_node->prev;
+                if (!current_node) {
+                    current = node_begin = nullptr;
+                    return;
+                }
+                node_begin = current_node->elem(0);
+                current = current_node->elem(current_node->count);
+            } else {
+                current = it.current;
+            }
+            --current;
+        }
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
+        reverse_iterator& operator++() {
+            if (current == node_begin) {
+                current_node = current_node->prev;
+                if (current_node) {
+                    node_begin = current_node->elem(0);
+                    current = node_begin + current_node->count - 1;
+                } else {
+                    current = node_begin = nullptr;
+                }
+            } else {
+                --current;
+            }
+            return *this;
+        }
+        reverse_iterator operator++(int) {
+            reverse_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        reverse_iterator& operator--() {
+            if (!current_node) {
+                current_node = parent->head;
+                if (current_node) current = node_begin = current_node->elem(0);
+            } else if (++current == current_node->elem(current_node->count)) {
+                current_node = current_node->next;
+                current = node_begin = current_node->elem(0);
+            }
+            return *this;
+        }
+        reverse_iterator operator--(int) {
+            reverse_iterator tmp(*this);
+            --(*this);
+            return tmp;
+        }
+        bool operator==(const reverse_iterator& other) const {
+            return current == other.current;
+        }
+        bool operator!=(const reverse_iterator& other) const {
+            return !(*this == other);
+        }
+
+        iterator base() const {
+            if (!current_node) return iterator(parent->head, 0, parent);
+            return iterator(current_node, current - node_begin + 1, parent);
+        }
+
+       private:
+        Node* current_node;
+        T* current;
+        T* node_begin;
+        const unrolled_list* parent;
+        friend class const_reverse_iterator;
+        friend class unrolled_list;
+    };
+
+    class const_reverse_iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_type = const_iterator;
+
+        const_reverse_iterator(Node* node, size_type index,
+                               const unrolled_list* parent)
+            : current_node(node),
+              current(node ? node->elem(index) : nullptr),
+              node_begin(node ? node->elem(0) : nullptr),
+              parent(parent) {}
+        const_reverse_iterator(const reverse_iterator& it)
+            : current_node(it.current_node),
+              current(it.current),
+              node_begin(it.node_begin),
+              parent(it.parent) {}
+        explicit const_reverse_iterator(const const_iterator& it)
+            : const_reverse_iterator(it.current_node, 0, it.parent) {
+            if (!current_node) {
+                current_node = parent->tail;
+                if (!current_node) return;
+                node_begin = current_node->elem(0);
+                current = current_node->elem(current_node->count);
+            } else if (it.current == node_begin) {
+                current_node = current_node->prev;
+                if (!current_node) {
+                    current = node_begin = nullptr;
+                    return;
+                }
+                node_begin = current_node->elem(0);
+                current = current_node->elem(current_node->count);
+            } else {
+                current = it.current;
+            }
+            --current;
+        }
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
+        const_reverse_iterator& operator++() {
+            if (current == node_begin) {
+                current_node = current_node->prev;
+                if (current_node) {
+                    node_begin = current_node->elem(0);
+                    current = node_begin + current_node->count - 1;
+                } else {
+                    current = node_begin = nullptr;
+                }
+            } else {
+                --current;
+            }
+            return *this;
+        }
+        const_reverse_iterator operator++(int) {
+            const_reverse_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        const_reverse_iterator& operator--() {
+            if (!current_node) {
+                current_node = parent->head;
+                if (current_node) current = node_begin = current_node->elem(0);
+            } else if (++current == current_node->elem(current_node->count)) {
+                current_node = current_node->next;
+                current = node_begin = current_node->elem(0);
+            }
+            return *this;
+        }
+        const_reverse_iterator operator--(int) {
+            const_reverse_iterator tmp(*this);
+            --(*this);
+            return tmp;
+        }
+        bool operator==(const const_reverse_iterator& other) const {
+            return current == other.current;
+        }
+        bool operator!=(const const_reverse_iterator& other) const {
+            return !(*this == other);
+        }
+
+        const_iterator base() const {
+            if (!current_node) return const_iterator(parent->head, 0, parent);
+            return const_iterator(current_node, current - node_begin + 1,
+                                  parent);
+        }
+
+       private:
+        Node* current_node;
+        const T* current;
+        const T* node_begin;
+        const unrolled_list* parent;
+        friend class unrolled_list;
+    };
 
     unrolled_list()
         : head(nullptr),
@@ -222,14 +462,25 @@ class unrolled_list {
     unrolled_list(std::initializer_list<T> ilist,
                   const Allocator& alloc = Allocator())
         : unrolled_list(ilist.begin(), ilist.end(), alloc) {}
+    explicit unrolled_list(std::span<const T> values,
+                           const Allocator& alloc = Allocator())
+        : head(nullptr),
+          tail(nullptr),
+          total_size(0),
+          allocator(alloc),
+          node_alloc(allocator) {
+        append_range(values);
+    }
     unrolled_list(unrolled_list&& other, const Allocator& alloc)
         : head(other.head),
           tail(other.tail),
           total_size(other.total_size),
+          allocated_nodes(other.allocated_nodes - other.spare_count),
           allocator(alloc),
           node_alloc(allocator) {
         other.head = other.tail = nullptr;
         other.total_size = 0;
+        other.allocated_nodes = other.spare_count;
     }
     unrolled_list(const unrolled_list& other)
         : head(nullptr),
@@ -259,10 +510,12 @@ class unrolled_list {
         : head(other.head),
           tail(other.tail),
           total_size(other.total_size),
+          allocated_nodes(other.allocated_nodes - other.spare_count),
           allocator(std::move(other.allocator)),
           node_alloc(allocator) {
         other.head = other.tail = nullptr;
         other.total_size = 0;
+        other.allocated_nodes = other.spare_count;
     }
     ~unrolled_list() { clear(); }
 
@@ -279,10 +532,12 @@ class unrolled_list {
             head = other.head;
             tail = other.tail;
             total_size = other.total_size;
+            allocated_nodes = other.allocated_nodes - other.spare_count;
             allocator = std::move(other.allocator);
             node_alloc = node_allocator(allocator);
             other.head = other.tail = nullptr;
             other.total_size = 0;
+            other.allocated_nodes = other.spare_count;
         }
         return *this;
     }
@@ -336,23 +591,157 @@ class unrolled_list {
     iterator end() { return iterator(nullptr, 0, this); }
     const_iterator end() const { return cend(); }
     const_iterator cend() const { return const_iterator(nullptr, 0, this); }
-    reverse_iterator rbegin() { return reverse_iterator(end()); }
-    reverse_iterator rend() { return reverse_iterator(begin()); }
+    reverse_iterator rbegin() {
+        return reverse_iterator(tail, tail ? tail->count - 1 : 0, this);
+    }
+    reverse_iterator rend() { return reverse_iterator(nullptr, 0, this); }
     const_reverse_iterator rbegin() const {
-        return const_reverse_iterator(end());
+        return const_reverse_iterator(tail, tail ? tail->count - 1 : 0, this);
     }
     const_reverse_iterator rend() const {
-        return const_reverse_iterator(begin());
+        return const_reverse_iterator(nullptr, 0, this);
     }
     const_reverse_iterator crbegin() const { return rbegin(); }
     const_reverse_iterator crend() const { return rend(); }
 
+    template <typename F>
+    void for_each_segment(F f) {
+        for (Node* cur = head; cur; cur = cur->next) {
+            f(std::span<T>(cur->elem(0), cur->count));
+        }
+    }
+    template <typename F>
+    void for_each_segment(F f) const {
+        for (const Node* cur = head; cur; cur = cur->next) {
+            f(std::span<const T>(cur->elem(0), cur->count));
+        }
+    }
+    template <typename F>
+    void for_each_segment_reverse(F f) {
+        for (Node* cur = tail; cur; cur = cur->prev) {
+            f(std::span<T>(cur->elem(0), cur->count));
+        }
+    }
+    template <typename F>
+    void for_each_segment_reverse(F f) const {
+        for (const Node* cur = tail; cur; cur = cur->prev) {
+            f(std::span<const T>(cur->elem(0), cur->count));
+        }
+    }
+
+    size_type copy_to(std::span<T> out) const {
+        size_type copied = 0;
+        for (const Node* cur = head; cur && copied < out.size();
+             cur = cur->next) {
+            size_type n = std::min(cur->count, out.size() - copied);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memcpy(out.data() + copied, cur->elem(0), n * sizeof(T));
+            } else {
+                std::copy_n(cur->elem(0), n, out.data() + copied);
+            }
+            copied += n;
+        }
+        return copied;
+    }
+    void gather(std::span<const size_type> indices, std::span<T> out) const {
+        check_index_set(indices, out.size());
+        const Node* node = head;
+        size_type base = 0;
+        for (size_type i = 0; i < indices.size(); ++i) {
+            assert(i == 0 || indices[i - 1] <= indices[i]);
+            while (indices[i] >= base + node->count) {
+                base += node->count;
+                node = node->next;
+            }
+            out[i] = *node->elem(indices[i] - base);
+        }
+    }
+    void scatter(std::span<const size_type> indices,
+                 std::span<const T> values) {
+        check_index_set(indices, values.size());
+        Node* node = head;
+        size_type base = 0;
+        for (size_type i = 0; i < indices.size(); ++i) {
+            assert(i == 0 || indices[i - 1] <= indices[i]);
+            while (indices[i] >= base + node->count) {
+                base += node->count;
+                node = node->next;
+            }
+            *node->elem(indices[i] - base) = values[i];
+        }
+    }
+    std::vector<T> to_vector() const {
+        std::vector<T> result;
+        result.reserve(total_size);
+        for (const Node* cur = head; cur; cur = cur->next) {
+            result.insert(result.end(), cur->elem(0),
+                          cur->elem(0) + cur->count);
+        }
+        return result;
+    }
+
+    frozen_unrolled_list<T, NodeMaxSize, Allocator> freeze() const& {
+        return frozen_unrolled_list<T, NodeMaxSize, Allocator>(*this);
+    }
+    frozen_unrolled_list<T, NodeMaxSize, Allocator> freeze() && {
+        return frozen_unrolled_list<T, NodeMaxSize, Allocator>(
+            std::move(*this));
+    }
+
+    template <typename Pred>
+    iterator partition_point(Pred pred) {
+        auto [node, index] = find_partition(pred);
+        return iterator(node, index, this);
+    }
+    template <typename Pred>
+    const_iterator partition_point(Pred pred) const {
+        auto [node, index] = find_partition(pred);
+        return const_iterator(node, index, this);
+    }
+    template <typename U, typename Compare = std::less<>>
+    iterator lower_bound(const U& value, Compare comp = Compare()) {
+        return partition_point(
+            [&](const T& elem) { return comp(elem, value); });
+    }
+    template <typename U, typename Compare = std::less<>>
+    const_iterator lower_bound(const U& value,
+                               Compare comp = Compare()) const {
+        return partition_point(
+            [&](const T& elem) { return comp(elem, value); });
+    }
+    template <typename U, typename Compare = std::less<>>
+    iterator upper_bound(const U& value, Compare comp = Compare()) {
+        return partition_point(
+            [&](const T& elem) { return !comp(value, elem); });
+    }
+    template <typename U, typename Compare = std::less<>>
+    const_iterator upper_bound(const U& value,
+                               Compare comp = Compare()) const {
+        return partition_point(
+            [&](const T& elem) { return !comp(value, elem); });
+    }
+
     bool empty() const { return total_size == 0; }
     size_type size() const { return total_size; }
     size_type max_size() const { return std::numeric_limits<size_type>::max(); }
     allocator_type get_allocator() const { return allocator; }
 
     void clear() noexcept {
+        release_spare_nodes(0);
+        if constexpr (releases_node_chains) {
+            if (head) {
+                if constexpr (!trivially_destroyed) {
+                    for (Node* cur = head; cur; cur = cur->next) {
+                        destroy_elements(cur, 0, cur->count);
+                    }
+                }
+                node_alloc.deallocate_chain(head, tail, allocated_nodes);
+            }
+            head = tail = nullptr;
+            total_size = 0;
+            allocated_nodes = 0;
+            return;
+        }
         Node* cur = head;
         while (cur) {
             Node* next = cur->next;
@@ -362,6 +751,36 @@ class unrolled_list {
         head = tail = nullptr;
         total_size = 0;
     }
+    void reset(size_type max_retained_nodes =
+                   std::numeric_limits<size_type>::max()) noexcept {
+        release_spare_nodes(max_retained_nodes);
+        Node* cur = head;
+        while (cur) {
+            Node* next = cur->next;
+            if (spare_count < max_retained_nodes) {
+                destroy_elements(cur, 0, cur->count);
+                cur->count = 0;
+                cur->prev = nullptr;
+                cur->next = spare;
+                spare = cur;
+                ++spare_count;
+            } else {
+                destroy_node(cur);
+            }
+            cur = next;
+        }
+        head = tail = nullptr;
+        total_size = 0;
+    }
+    // Forgets every node without destroying elements or handing nodes back
+    // to the allocator. Meant for lists whose node storage has already been
+    // dropped in bulk, such as by node_arena::release().
+    void abandon() noexcept {
+        head = tail = spare = nullptr;
+        total_size = spare_count = allocated_nodes = 0;
+    }
+    size_type spare_nodes() const noexcept { return spare_count; }
+    void shrink_to_fit() noexcept { release_spare_nodes(0); }
     void push_back(const T& value) { emplace_back(value); }
     void push_back(T&& value) { emplace_back(std::move(value)); }
     void pop_back() { erase(--end()); }
@@ -376,7 +795,7 @@ class unrolled_list {
         return emplace(pos, std::move(value));
     }
     iterator insert(const_iterator pos, size_type count, const T& value) {
-        iterator it = iterator(pos.current_node, pos.index_in_node, this);
+        iterator it = iterator(pos.current_node, pos.index_in_node(), this);
         iterator firstInserted = it;
         for (size_type i = 0; i < count; i++) {
             it = insert(it, value);
@@ -397,7 +816,7 @@ class unrolled_list {
                                       std::forward<Args>(args)...);
         else {
             Node* node = pos.current_node;
-            size_type idx = pos.index_in_node;
+            size_type idx = pos.index_in_node();
             return emplace_into_node_(node, idx, std::forward<Args>(args)...);
         }
     }
@@ -415,12 +834,186 @@ class unrolled_list {
         clear();
         for (; first != last; ++first) push_back(*first);
     }
+    void append_range(std::span<const T> values) {
+        Node* old_tail = tail;
+        size_type old_count = tail ? tail->count : 0;
+        const T* src = values.data();
+        size_type remaining = values.size();
+        try {
+            while (remaining) {
+                if (!tail || tail->count == NodeMaxSize) link_tail_node();
+                size_type n = std::min(remaining, NodeMaxSize - tail->count);
+                copy_into_tail(src, n);
+                src += n;
+                remaining -= n;
+            }
+        } catch (...) {
+            truncate_after(old_tail, old_count);
+            throw;
+        }
+    }
     template <typename InputIt>
     void prepend_range(InputIt first, InputIt last) {
         for (; first != last; ++first) push_front(*first);
     }
 
+    template <typename InputIt>
+    void insert_batch(InputIt first, InputIt last) {
+        size_type initial_spare = spare_count;
+        Node* node = head;
+        size_type base = 0;
+        try {
+            while (first != last) {
+                size_type pos = std::get<0>(*first);
+                assert(pos >= base);
+                while (node && pos >= base + node->count) {
+                    base += node->count;
+                    node = node->next;
+                }
+                if (!node) {
+                    for (; first != last; ++first) {
+                        append_value(std::get<1>(*first));
+                    }
+                    break;
+                }
+                size_type old_count = node->count;
+                node = rebuild_with_inserts(node, base, first, last)->next;
+                base += old_count;
+            }
+        } catch (...) {
+            release_spare_nodes(initial_spare);
+            throw;
+        }
+        release_spare_nodes(initial_spare);
+    }
+
+    iterator rotate(const_iterator middle) {
+        Node* first_node = head;
+        Node* node = middle.current_node;
+        if (!node) return begin();
+        if (node == head && middle.index_in_node() == 0) return end();
+        if (middle.index_in_node() > 0) {
+            node = split_node(node, middle.index_in_node());
+        }
+
+        Node* new_tail = node->prev;
+        new_tail->next = nullptr;
+        node->prev = nullptr;
+        tail->next = head;
+        head->prev = tail;
+        head = node;
+        tail = new_tail;
+        return iterator(first_node, 0, this);
+    }
+    iterator rotate_left(size_type n) {
+        if (total_size == 0) return end();
+        auto [node, index] = locate(n % total_size);
+        return rotate(const_iterator(node, index, this));
+    }
+    iterator rotate_right(size_type n) {
+        if (total_size == 0) return end();
+        return rotate_left(total_size - n % total_size);
+    }
+
+    template <typename InputIt>
+    size_type erase_indices(InputIt first, InputIt last) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        size_type erased = 0;
+        size_type initial_spare = spare_count;
+        Node* node = head;
+        size_type base = 0;
+        while (first != last && node) {
+            size_type index = *first;
+            assert(index >= base);
+            while (node && index >= base + node->count) {
+                base += node->count;
+                node = node->next;
+            }
+            if (!node) break;
+
+            size_type old_count = node->count;
+            if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                size_type write = index - base;
+                for (size_type read = write; read < old_count; ++read) {
+                    assert(first == last || *first >= base + read);
+                    if (first != last && *first == base + read) {
+                        allocator_traits::destroy(allocator, node->elem(read));
+                        while (first != last && *first == base + read) {
+                            ++first;
+                        }
+                        continue;
+                    }
+                    if (write != read) {
+                        allocator_traits::construct(
+                            allocator, node->elem(write),
+                            std::move(*node->elem(read)));
+                        allocator_traits::destroy(allocator, node->elem(read));
+                    }
+                    ++write;
+                }
+                node->count = write;
+            } else {
+                try {
+                    node = compact_into_new_node(node, base, first, last);
+                } catch (...) {
+                    release_spare_nodes(initial_spare);
+                    throw;
+                }
+                release_spare_nodes(initial_spare);
+            }
+            erased += old_count - node->count;
+            total_size -= old_count - node->count;
+            base += old_count;
+
+            Node* next = node->next;
+            if (node->count == 0) remove_node(node);
+            node = next;
+        }
+        return erased;
+    }
+
+    void splice(const_iterator pos, unrolled_list& other) {
+        assert(allocator == other.allocator);
+        if (&other == this || !other.head) return;
+
+        Node* before = tail;
+        Node* after = nullptr;
+        if (pos.current_node) {
+            size_type index = pos.index_in_node();
+            if (index == 0) {
+                after = pos.current_node;
+            } else {
+                after = split_node(pos.current_node, index);
+            }
+            before = after->prev;
+        }
+
+        other.head->prev = before;
+        other.tail->next = after;
+        if (before) {
+            before->next = other.head;
+        } else {
+            head = other.head;
+        }
+        if (after) {
+            after->prev = other.tail;
+        } else {
+            tail = other.tail;
+        }
+        total_size += other.total_size;
+        size_type moved_nodes = other.allocated_nodes - other.spare_count;
+        allocated_nodes += moved_nodes;
+
+        other.head = other.tail = nullptr;
+        other.total_size = 0;
+        other.allocated_nodes -= moved_nodes;
+    }
+    void splice(const_iterator pos, unrolled_list&& other) {
+        splice(pos, other);
+    }
+
     iterator erase(const_iterator pos) {
+        if (!pos.current_node) return end();
         const_iterator pos_end = pos;
         ++pos_end;
         return erase(pos, pos_end);
@@ -454,18 +1047,18 @@ class unrolled_list {
 
     iterator erase(const_iterator first, const_iterator last) {
         if (first == last || total_size == 0) {
-            return iterator(first.current_node, first.index_in_node, this);
+            return iterator(first.current_node, first.index_in_node(), this);
         }
 
         Node* end_node = last.current_node;
-        size_type end_index = last.index_in_node;
+        size_type end_index = last.index_in_node();
         if (!end_node) {
             end_node = tail;
             end_index = tail->count;
         }
 
         Node* start_node = first.current_node;
-        size_type start_index = first.index_in_node;
+        size_type start_index = first.index_in_node();
         if (!start_node) {
             start_node = head;
             start_index = 0;
@@ -474,10 +1067,8 @@ class unrolled_list {
         size_type erasedCount = 0;
 
         if (start_node == end_node) {
-            for (size_type i = start_index; i < end_index; ++i) {
-                allocator_traits::destroy(allocator, start_node->elem(i));
-                ++erasedCount;
-            }
+            destroy_elements(start_node, start_index, end_index);
+            erasedCount = end_index - start_index;
             normalize_node(end_node, end_index, erasedCount);
             start_node->count -= erasedCount;
             total_size -= erasedCount;
@@ -489,10 +1080,8 @@ class unrolled_list {
             return iterator(start_node, start_index, this);
         }
 
-        for (size_type i = start_index; i < start_node->count; ++i) {
-            allocator_traits::destroy(allocator, start_node->elem(i));
-            ++erasedCount;
-        }
+        destroy_elements(start_node, start_index, start_node->count);
+        erasedCount = start_node->count - start_index;
         start_node->count = start_index;
 
         Node* cur = start_node->next;
@@ -501,19 +1090,14 @@ class unrolled_list {
         }
 
         while (cur && cur != end_node) {
-            for (size_type i = 0; i < cur->count; ++i) {
-                allocator_traits::destroy(allocator, cur->elem(i));
-                ++erasedCount;
-            }
+            erasedCount += cur->count;
             Node* next = cur->next;
             remove_node(cur);
             cur = next;
         }
 
-        for (size_type i = 0; i < end_index; ++i) {
-            allocator_traits::destroy(allocator, end_node->elem(i));
-            ++erasedCount;
-        }
+        destroy_elements(end_node, 0, end_index);
+        erasedCount += end_index;
         normalize_node(end_node, end_index, end_index);
         end_node->count -= end_index;
         total_size -= erasedCount;
@@ -526,21 +1110,314 @@ class unrolled_list {
     }
 
    private:
+    template <typename, size_t, typename, typename, typename>
+    friend class indexed_unrolled_list;
+    template <typename, size_t, typename>
+    friend class bounded_unrolled_list;
+    template <typename, typename, size_t, typename>
+    friend class sliding_window_aggregator;
+    template <typename, size_t, typename, typename>
+    friend class time_series_unrolled_list;
+
+    static constexpr bool trivially_destroyed =
+        std::is_trivially_destructible_v<T> &&
+        !requires(allocator_type& alloc, T* p) { alloc.destroy(p); };
+    static constexpr bool trivially_constructed =
+        std::is_trivially_copyable_v<T> &&
+        !requires(allocator_type& alloc, T* p) { alloc.construct(p, *p); };
+    static constexpr bool releases_node_chains =
+        std::is_trivially_destructible_v<Node> &&
+        requires(node_allocator& alloc, Node* p) {
+            alloc.deallocate_chain(p, p, size_type{1});
+        };
+
     Node* head = nullptr;
     Node* tail = nullptr;
     size_type total_size = 0;
+    Node* spare = nullptr;
+    size_type spare_count = 0;
+    size_type allocated_nodes = 0;
     allocator_type allocator = Allocator();
     node_allocator node_alloc;
 
+    static Node* node_of(const_iterator pos) { return pos.current_node; }
+
     Node* create_node() {
+        if (spare) {
+            Node* p = spare;
+            spare = p->next;
+            --spare_count;
+            p->next = nullptr;
+            return p;
+        }
         Node* p = node_allocator_traits::allocate(node_alloc, 1);
-        node_allocator_traits::construct(node_alloc, p, allocator);
+        node_allocator_traits::construct(node_alloc, p);
+        ++allocated_nodes;
         return p;
     }
 
     void destroy_node(Node* p) {
+        destroy_elements(p, 0, p->count);
         node_allocator_traits::destroy(node_alloc, p);
         node_allocator_traits::deallocate(node_alloc, p, 1);
+        --allocated_nodes;
+    }
+    void release_spare_nodes(size_type keep) noexcept {
+        while (spare_count > keep) {
+            Node* next = spare->next;
+            destroy_node(spare);
+            spare = next;
+            --spare_count;
+        }
+    }
+    void destroy_elements(Node* p, size_type from, size_type to) {
+        if constexpr (!trivially_destroyed) {
+            for (size_type i = from; i < to; ++i) {
+                allocator_traits::destroy(allocator, p->elem(i));
+            }
+        }
+    }
+    void copy_into_tail(const T* src, size_type n) {
+        if constexpr (trivially_constructed) {
+            std::memcpy(tail->elem(tail->count), src, n * sizeof(T));
+            tail->count += n;
+            total_size += n;
+        } else {
+            for (size_type i = 0; i < n; ++i) {
+                allocator_traits::construct(allocator, tail->elem(tail->count),
+                                            src[i]);
+                ++tail->count;
+                ++total_size;
+            }
+        }
+    }
+    template <typename Pred>
+    std::pair<Node*, size_type> find_partition(Pred& pred) const {
+        Node* node = head;
+        while (node && pred(std::as_const(*node->elem(node->count - 1)))) {
+            node = node->next;
+        }
+        if (!node) return {nullptr, 0};
+        const T* first = node->elem(0);
+        const T* point =
+            std::partition_point(first, first + node->count, std::ref(pred));
+        return {node, static_cast<size_type>(point - first)};
+    }
+    std::pair<Node*, size_type> locate(size_type index) const {
+        Node* node = head;
+        while (node && index >= node->count) {
+            index -= node->count;
+            node = node->next;
+        }
+        return {node, index};
+    }
+    void check_index_set(std::span<const size_type> indices,
+                         size_type values) const {
+        if (indices.size() != values) {
+            throw std::length_error("Index and value counts differ");
+        }
+        if (!indices.empty() && indices.back() >= total_size) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+    void link_tail_node() { link_tail_node(create_node()); }
+    void link_tail_node(Node* node) noexcept {
+        node->prev = tail;
+        if (tail) {
+            tail->next = node;
+        } else {
+            head = node;
+        }
+        tail = node;
+    }
+    template <typename... Args>
+    void append_value(Args&&... args) {
+        if (!tail || tail->count == NodeMaxSize) link_tail_node();
+        try {
+            allocator_traits::construct(allocator, tail->elem(tail->count),
+                                        std::forward<Args>(args)...);
+        } catch (...) {
+            if (tail->count == 0) remove_node(tail);
+            throw;
+        }
+        ++tail->count;
+        ++total_size;
+    }
+    template <typename InputIt>
+    Node* rebuild_with_inserts(Node* node, size_type base, InputIt& first,
+                               InputIt last) {
+        Node* chain = create_node();
+        Node* out = chain;
+        size_type inserted = 0;
+        size_type moved = 0;
+        T* moved_to[NodeMaxSize];
+        auto emit = [&](auto&& value) {
+            if (out->count == NodeMaxSize) {
+                Node* next = create_node();
+                next->prev = out;
+                out->next = next;
+                out = next;
+            }
+            allocator_traits::construct(allocator, out->elem(out->count),
+                                        std::forward<decltype(value)>(value));
+            return out->elem(out->count++);
+        };
+        try {
+            for (size_type i = 0; i < node->count; ++i) {
+                for (; first != last && std::get<0>(*first) == base + i;
+                     ++first) {
+                    emit(std::get<1>(*first));
+                    ++inserted;
+                }
+                moved_to[moved++] =
+                    emit(std::move_if_noexcept(*node->elem(i)));
+            }
+        } catch (...) {
+            if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                for (size_type i = 0; i < moved; ++i) {
+                    allocator_traits::destroy(allocator, node->elem(i));
+                    allocator_traits::construct(allocator, node->elem(i),
+                                                std::move(*moved_to[i]));
+                }
+            }
+            while (chain) {
+                Node* next = chain->next;
+                destroy_node(chain);
+                chain = next;
+            }
+            throw;
+        }
+
+        chain->prev = node->prev;
+        out->next = node->next;
+        if (node->prev) {
+            node->prev->next = chain;
+        } else {
+            head = chain;
+        }
+        if (node->next) {
+            node->next->prev = out;
+        } else {
+            tail = out;
+        }
+        total_size += inserted;
+
+        destroy_elements(node, 0, node->count);
+        node->count = 0;
+        retain_node(node);
+        return out;
+    }
+    // Copies the elements of node that are not erased into a new node,
+    // which replaces node only once it is complete, so a throwing copy
+    // leaves node as it was.
+    template <typename InputIt>
+    Node* compact_into_new_node(Node* node, size_type base, InputIt& first,
+                                InputIt last) {
+        Node* out = create_node();
+        try {
+            for (size_type read = 0; read < node->count; ++read) {
+                assert(first == last || *first >= base + read);
+                if (first != last && *first == base + read) {
+                    while (first != last && *first == base + read) {
+                        ++first;
+                    }
+                    continue;
+                }
+                allocator_traits::construct(
+                    allocator, out->elem(out->count),
+                    std::move_if_noexcept(*node->elem(read)));
+                ++out->count;
+            }
+        } catch (...) {
+            destroy_elements(out, 0, out->count);
+            out->count = 0;
+            retain_node(out);
+            throw;
+        }
+
+        out->prev = node->prev;
+        out->next = node->next;
+        if (node->prev) {
+            node->prev->next = out;
+        } else {
+            head = out;
+        }
+        if (node->next) {
+            node->next->prev = out;
+        } else {
+            tail = out;
+        }
+        destroy_elements(node, 0, node->count);
+        node->count = 0;
+        retain_node(node);
+        return out;
+    }
+    Node* detach_head() noexcept {
+        Node* node = head;
+        destroy_elements(node, 0, node->count);
+        total_size -= node->count;
+        node->count = 0;
+        head = node->next;
+        if (head) {
+            head->prev = nullptr;
+        } else {
+            tail = nullptr;
+        }
+        node->next = nullptr;
+        return node;
+    }
+    void retain_node(Node* node) noexcept {
+        node->prev = nullptr;
+        node->next = spare;
+        spare = node;
+        ++spare_count;
+    }
+    void truncate_after(Node* last, size_type last_count) noexcept {
+        Node* cur = last ? last->next : head;
+        while (cur) {
+            Node* next = cur->next;
+            total_size -= cur->count;
+            destroy_node(cur);
+            cur = next;
+        }
+        if (last) {
+            destroy_elements(last, last_count, last->count);
+            total_size -= last->count - last_count;
+            last->count = last_count;
+            last->next = nullptr;
+        } else {
+            head = nullptr;
+        }
+        tail = last;
+    }
+    Node* split_node(Node* node, size_type index) {
+        Node* new_node = create_node();
+        try {
+            for (size_type i = index; i < node->count; ++i) {
+                allocator_traits::construct(allocator,
+                                            new_node->elem(new_node->count),
+                                            std::move_if_noexcept(
+                                                *node->elem(i)));
+                ++new_node->count;
+            }
+        } catch (...) {
+            destroy_elements(new_node, 0, new_node->count);
+            new_node->count = 0;
+            retain_node(new_node);
+            throw;
+        }
+        destroy_elements(node, index, node->count);
+        node->count = index;
+
+        new_node->prev = node;
+        new_node->next = node->next;
+        if (node->next) {
+            node->next->prev = new_node;
+        } else {
+            tail = new_node;
+        }
+        node->next = new_node;
+        return new_node;
     }
     void normalize_node(Node* p, const size_type from, const size_type shift) {
         if (shift == 0) {
@@ -603,7 +1480,12 @@ class unrolled_list {
         std::swap(head, other.head);
         std::swap(tail, other.tail);
         std::swap(total_size, other.total_size);
+        std::swap(spare, other.spare);
+        std::swap(spare_count, other.spare_count);
+        std::swap(allocated_nodes, other.allocated_nodes);
         std::swap(allocator, other.allocator);
         std::swap(node_alloc, other.node_alloc);
     }
 };
+
+#include <frozen_unrolled_list.h>
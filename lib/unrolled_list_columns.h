@@ -0,0 +1,124 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class aligned_column {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "column buffers hold trivially copyable values only");
+
+   public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type alignment = 64;
+
+    aligned_column() noexcept : values(nullptr), count(0) {}
+    explicit aligned_column(size_type count)
+        : values(count ? static_cast<T*>(::operator new(
+                             padded_bytes(count), std::align_val_t(alignment)))
+                       : nullptr),
+          count(count) {
+        if (values) {
+            std::memset(reinterpret_cast<std::byte*>(values) + bytes(), 0,
+                        padded_bytes(count) - bytes());
+        }
+    }
+    aligned_column(const aligned_column&) = delete;
+    aligned_column& operator=(const aligned_column&) = delete;
+    aligned_column(aligned_column&& other) noexcept
+        : values(other.values), count(other.count) {
+        other.values = nullptr;
+        other.count = 0;
+    }
+    aligned_column& operator=(aligned_column&& other) noexcept {
+        if (this != &other) {
+            release();
+            values = other.values;
+            count = other.count;
+            other.values = nullptr;
+            other.count = 0;
+        }
+        return *this;
+    }
+    ~aligned_column() { release(); }
+
+    T* data() noexcept { return values; }
+    const T* data() const noexcept { return values; }
+    size_type size() const noexcept { return count; }
+    bool empty() const noexcept { return count == 0; }
+    size_type bytes() const noexcept { return count * sizeof(T); }
+    std::span<T> span() noexcept { return {values, count}; }
+    std::span<const T> span() const noexcept { return {values, count}; }
+
+    T& operator[](size_type index) { return values[index]; }
+    const T& operator[](size_type index) const { return values[index]; }
+
+   private:
+    T* values;
+    size_type count;
+
+    static size_type padded_bytes(size_type count) {
+        return (count * sizeof(T) + alignment - 1) / alignment * alignment;
+    }
+
+    void release() noexcept {
+        if (!values) return;
+        ::operator delete(values, padded_bytes(count),
+                          std::align_val_t(alignment));
+        values = nullptr;
+        count = 0;
+    }
+};
+
+template <typename T, size_t NodeMaxSize, typename Allocator>
+aligned_column<T> export_column(
+    const unrolled_list<T, NodeMaxSize, Allocator>& list) {
+    aligned_column<T> column(list.size());
+    list.copy_to(column.span());
+    return column;
+}
+
+template <typename T, size_t NodeMaxSize, typename Allocator, typename Field>
+aligned_column<Field> export_column(
+    const unrolled_list<T, NodeMaxSize, Allocator>& list, Field T::*field) {
+    aligned_column<Field> column(list.size());
+    Field* out = column.data();
+    list.for_each_segment([&](std::span<const T> segment) {
+        for (const T& value : segment) {
+            *out++ = value.*field;
+        }
+    });
+    return column;
+}
+
+template <typename T, size_t NodeMaxSize, typename Allocator>
+std::vector<std::span<const T>> export_chunks(
+    const unrolled_list<T, NodeMaxSize, Allocator>& list) {
+    std::vector<std::span<const T>> chunks;
+    list.for_each_segment(
+        [&](std::span<const T> segment) { chunks.push_back(segment); });
+    return chunks;
+}
+
+template <typename T, size_t NodeMaxSize, typename Allocator, typename Field>
+void import_column(unrolled_list<T, NodeMaxSize, Allocator>& list,
+                   Field T::*field, std::span<const Field> column) {
+    if (column.size() != list.size()) {
+        throw std::length_error("Column size does not match list size");
+    }
+    const Field* in = column.data();
+    list.for_each_segment([&](std::span<T> segment) {
+        for (T& value : segment) {
+            value.*field = *in++;
+        }
+    });
+}
@@ -0,0 +1,245 @@
+#pragma once
+#include <unrolled_list.h>
+
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t NodeMaxSize = 10,
+          typename Allocator = std::allocator<T>>
+class unrolled_list_ptr {
+   public:
+    using list_type = unrolled_list<T, NodeMaxSize, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = typename list_type::size_type;
+    using reference = typename list_type::reference;
+    using const_reference = typename list_type::const_reference;
+    using difference_type = typename list_type::difference_type;
+    using iterator = typename list_type::iterator;
+    using const_iterator = typename list_type::const_iterator;
+    using reverse_iterator = typename list_type::reverse_iterator;
+    using const_reverse_iterator = typename list_type::const_reverse_iterator;
+
+    static_assert(std::allocator_traits<Allocator>::is_always_equal::value,
+                  "unrolled_list_ptr keeps no allocator state, so the "
+                  "allocator has to be stateless");
+
+    unrolled_list_ptr() noexcept = default;
+    unrolled_list_ptr(std::initializer_list<T> ilist) {
+        if (ilist.size() != 0) {
+            list = create_list(ilist);
+        }
+    }
+    unrolled_list_ptr(const unrolled_list_ptr& other) {
+        if (other.list) {
+            list = create_list(*other.list);
+        }
+    }
+    unrolled_list_ptr(unrolled_list_ptr&& other) noexcept : list(other.list) {
+        other.list = nullptr;
+    }
+    ~unrolled_list_ptr() { clear(); }
+
+    unrolled_list_ptr& operator=(const unrolled_list_ptr& other) {
+        if (this != &other) {
+            unrolled_list_ptr tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+    unrolled_list_ptr& operator=(unrolled_list_ptr&& other) noexcept {
+        if (this != &other) {
+            clear();
+            list = other.list;
+            other.list = nullptr;
+        }
+        return *this;
+    }
+    bool operator==(const unrolled_list_ptr& other) const {
+        if (!list || !other.list) return list == other.list;
+        return *list == *other.list;
+    }
+    bool operator!=(const unrolled_list_ptr& other) const {
+        return !(*this == other);
+    }
+
+    list_type* get() noexcept { return list; }
+    const list_type* get() const noexcept { return list; }
+
+    reference operator[](size_type index) { return (*list)[index]; }
+    const_reference operator[](size_type index) const {
+        return (*list)[index];
+    }
+    reference front() {
+        if (!list) throw std::out_of_range("List is empty");
+        return list->front();
+    }
+    const_reference front() const {
+        if (!list) throw std::out_of_range("List is empty");
+        return list->front();
+    }
+    reference back() {
+        if (!list) throw std::out_of_range("List is empty");
+        return list->back();
+    }
+    const_reference back() const {
+        if (!list) throw std::out_of_range("List is empty");
+        return list->back();
+    }
+
+    iterator begin() {
+        return list ? list->begin() : iterator(nullptr, 0, nullptr);
+    }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator cbegin() const {
+        return list ? list->cbegin() : const_iterator(nullptr, 0, nullptr);
+    }
+    iterator end() {
+        return list ? list->end() : iterator(nullptr, 0, nullptr);
+    }
+    const_iterator end() const { return cend(); }
+    const_iterator cend() const {
+        return list ? list->cend() : const_iterator(nullptr, 0, nullptr);
+    }
+    reverse_iterator rbegin() {
+        return list ? list->rbegin() : reverse_iterator(nullptr, 0, nullptr);
+    }
+    reverse_iterator rend() {
+        return list ? list->rend() : reverse_iterator(nullptr, 0, nullptr);
+    }
+    const_reverse_iterator rbegin() const {
+        return list ? list->crbegin()
+                    : const_reverse_iterator(nullptr, 0, nullptr);
+    }
+    const_reverse_iterator rend() const {
+        return list ? list->crend()
+                    : const_reverse_iterator(nullptr, 0, nullptr);
+    }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    bool empty() const noexcept { return list == nullptr; }
+    size_type size() const noexcept { return list ? list->size() : 0; }
+    allocator_type get_allocator() const { return allocator_type(); }
+
+    void clear() noexcept {
+        if (list) {
+            destroy_list(list);
+            list = nullptr;
+        }
+    }
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+    void pop_back() {
+        if (!list) return;
+        list->pop_back();
+        release_if_empty();
+    }
+    void pop_front() {
+        if (!list) return;
+        list->pop_front();
+        release_if_empty();
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        with_list([&](list_type& l) {
+            l.emplace_back(std::forward<Args>(args)...);
+        });
+    }
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        with_list([&](list_type& l) {
+            l.emplace_front(std::forward<Args>(args)...);
+        });
+    }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        iterator ret(nullptr, 0, nullptr);
+        with_list([&](list_type& l) {
+            ret = l.emplace(list ? pos : l.cend(), std::forward<Args>(args)...);
+        });
+        return ret;
+    }
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator erase(const_iterator pos) {
+        if (!list) return end();
+        iterator ret = list->erase(pos);
+        if (list->empty()) {
+            clear();
+            return end();
+        }
+        return ret;
+    }
+    iterator erase(const_iterator first, const_iterator last) {
+        if (!list) return end();
+        iterator ret = list->erase(first, last);
+        if (list->empty()) {
+            clear();
+            return end();
+        }
+        return ret;
+    }
+
+    void swap(unrolled_list_ptr& other) noexcept {
+        std::swap(list, other.list);
+    }
+
+   private:
+    using header_allocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            list_type>;
+    using header_allocator_traits = std::allocator_traits<header_allocator>;
+
+    list_type* list = nullptr;
+
+    template <typename... Args>
+    static list_type* create_list(Args&&... args) {
+        header_allocator alloc;
+        list_type* p = header_allocator_traits::allocate(alloc, 1);
+        try {
+            header_allocator_traits::construct(alloc, p,
+                                               std::forward<Args>(args)...);
+        } catch (...) {
+            header_allocator_traits::deallocate(alloc, p, 1);
+            throw;
+        }
+        return p;
+    }
+
+    static void destroy_list(list_type* p) noexcept {
+        header_allocator alloc;
+        header_allocator_traits::destroy(alloc, p);
+        header_allocator_traits::deallocate(alloc, p, 1);
+    }
+
+    template <typename F>
+    void with_list(F f) {
+        if (list) {
+            f(*list);
+            return;
+        }
+        list_type* fresh = create_list();
+        try {
+            f(*fresh);
+        } catch (...) {
+            destroy_list(fresh);
+            throw;
+        }
+        list = fresh;
+    }
+
+    void release_if_empty() noexcept {
+        if (list->empty()) clear();
+    }
+};
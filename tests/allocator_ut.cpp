@@ -108,3 +108,61 @@ TEST_F(WorkWithAllocatorTest, simplePushBack) {
     ASSERT_EQ(SomeObj::ConstructorCalled, 11);
     ASSERT_EQ(SomeObj::DestructorCalled, 11);
 }
+
+/*
+    В тесте задаётся NodeMaxSize = 5, добавляется 30 элементов,
+    а затем удаляется диапазон, захватывающий несколько нод целиком.
+
+    Ожидается, что деструктор каждого удалённого объекта будет вызван ровно один раз
+*/
+TEST_F(WorkWithAllocatorTest, eraseAcrossNodes) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+    for (int i = 0; i < 30; ++i) {
+        list.push_back(SomeObj{});
+    }
+    SomeObj::DestructorCalled = 0;
+
+    auto first = list.begin();
+    auto last = list.end();
+    std::advance(first, 3);
+    std::advance(last, -3);
+    list.erase(first, last);
+
+    ASSERT_EQ(list.size(), 6);
+    ASSERT_EQ(SomeObj::DestructorCalled, 24);
+
+    list.clear();
+    ASSERT_EQ(SomeObj::DestructorCalled, 30);
+}
+
+/*
+    В тесте задаётся NodeMaxSize = 5, список заполняется 20 элементами,
+    после чего несколько раз вызывается reset() и список заполняется заново.
+
+    Ожидается, что повторные заполнения не делают ни одной аллокации Node,
+    а reset() с ограничением оставляет не больше заданного числа нод
+*/
+TEST_F(WorkWithAllocatorTest, resetKeepsNodes) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+    for (int i = 0; i < 20; ++i) {
+        list.push_back(SomeObj{});
+    }
+    const int allocations = TestAllocator<NodeTag>::AllocationCount;
+
+    for (int round = 0; round < 10; ++round) {
+        list.reset();
+        ASSERT_TRUE(list.empty());
+        for (int i = 0; i < 20; ++i) {
+            list.push_back(SomeObj{});
+        }
+    }
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, allocations);
+
+    list.reset(2);
+    ASSERT_EQ(list.spare_nodes(), 2);
+
+    list.shrink_to_fit();
+    ASSERT_EQ(list.spare_nodes(), 0);
+}
@@ -0,0 +1,81 @@
+#include <append_only_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(AppendOnlyUnrolledList, pushBack) {
+    append_only_unrolled_list<std::string, 4> list;
+    std::vector<std::string> expected;
+
+    for (int i = 0; i < 50; ++i) {
+        list.push_back(std::to_string(i));
+        expected.push_back(std::to_string(i));
+    }
+
+    auto snapshot = list.read();
+    ASSERT_EQ(snapshot.size(), 50);
+    ASSERT_THAT(snapshot, ::testing::ElementsAreArray(expected));
+}
+
+/*
+    Снимок фиксирует опубликованный на момент чтения префикс
+    и не видит элементов, добавленных позже
+*/
+TEST(AppendOnlyUnrolledList, snapshotIsPrefix) {
+    append_only_unrolled_list<int, 4> list;
+    for (int i = 0; i < 6; ++i) {
+        list.push_back(i);
+    }
+
+    auto snapshot = list.read();
+    for (int i = 6; i < 20; ++i) {
+        list.push_back(i);
+    }
+
+    ASSERT_THAT(snapshot, ::testing::ElementsAre(0, 1, 2, 3, 4, 5));
+    ASSERT_EQ(list.size(), 20);
+}
+
+/*
+    Стресс-тест для сборки с -fsanitize=thread (UNROLLED_LIST_ENABLE_TSAN):
+    один писатель добавляет элементы, читатели параллельно обходят опубликованный префикс
+    и проверяют, что он состоит из 0, 1, 2, ... без пропусков
+*/
+TEST(AppendOnlyUnrolledList, concurrentReaders) {
+    constexpr int kElements = 20000;
+    append_only_unrolled_list<int, 16> list;
+    std::atomic<bool> consistent = true;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            size_t seen = 0;
+            while (seen < kElements) {
+                auto snapshot = list.read();
+                int expected = 0;
+                for (int value : snapshot) {
+                    if (value != expected++) consistent = false;
+                }
+                if (static_cast<size_t>(expected) != snapshot.size()) {
+                    consistent = false;
+                }
+                seen = snapshot.size();
+            }
+        });
+    }
+
+    for (int i = 0; i < kElements; ++i) {
+        list.push_back(i);
+    }
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(consistent.load());
+    ASSERT_EQ(list.size(), kElements);
+}
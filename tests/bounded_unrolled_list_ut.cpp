@@ -0,0 +1,128 @@
+#include <bounded_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct AllocationCounter {
+    static inline int Allocations = 0;
+};
+
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    template <typename U>
+    struct rebind {
+        using other = CountingAllocator<U>;
+    };
+
+    T* allocate(std::size_t n) {
+        ++AllocationCounter::Allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+std::vector<int> Range(int first, int last) {
+    std::vector<int> values(last - first);
+    std::iota(values.begin(), values.end(), first);
+    return values;
+}
+
+}  // namespace
+
+/*
+    Когда бюджет нод исчерпан, push_back в заполненную хвостовую ноду
+    выбрасывает самую старую ноду целиком и переиспользует её как хвост
+*/
+TEST(BoundedUnrolledList, dropsOldestNode) {
+    bounded_unrolled_list<int, 4> list(3);
+    ASSERT_EQ(list.capacity(), 12);
+
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+        ASSERT_LE(list.size(), list.capacity());
+        ASSERT_LE(list.node_count(), 3);
+        ASSERT_EQ(list.back(), i);
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(Range(88, 100)));
+
+    list.push_back(100);
+    ASSERT_THAT(list, ::testing::ElementsAreArray(Range(92, 101)));
+    ASSERT_EQ(list.front(), 92);
+    ASSERT_EQ(list.node_count(), 3);
+
+    std::vector<int> expected = Range(92, 101);
+    std::vector<int> reversed(list.rbegin(), list.rend());
+    ASSERT_THAT(reversed,
+                ::testing::ElementsAreArray(expected.rbegin(), expected.rend()));
+}
+
+TEST(BoundedUnrolledList, singleNodeBudget) {
+    bounded_unrolled_list<int, 4> list(1);
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_THAT(list, ::testing::ElementsAre(8, 9));
+    ASSERT_EQ(list.node_count(), 1);
+
+    ASSERT_THROW(bounded_unrolled_list<int> empty_budget(0),
+                 std::invalid_argument);
+}
+
+TEST(BoundedUnrolledList, popFrontKeepsNodes) {
+    bounded_unrolled_list<std::string, 3> list(2);
+    for (int i = 0; i < 6; ++i) {
+        list.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 3; ++i) {
+        list.pop_front();
+    }
+    ASSERT_EQ(list.node_count(), 1);
+    ASSERT_EQ(list.items().spare_nodes(), 1);
+    ASSERT_THAT(list, ::testing::ElementsAre("3", "4", "5"));
+
+    for (int i = 6; i < 11; ++i) {
+        list.push_back(std::to_string(i));
+    }
+    ASSERT_EQ(list.items().spare_nodes(), 0);
+    ASSERT_THAT(list, ::testing::ElementsAre("6", "7", "8", "9", "10"));
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.node_count(), 0);
+    ASSERT_EQ(list.items().spare_nodes(), 2);
+}
+
+/*
+    После того как все ноды бюджета созданы, ни push_back, ни pop_front,
+    ни clear с повторным заполнением не обращаются к аллокатору
+*/
+TEST(BoundedUnrolledList, noAllocationsAfterWarmUp) {
+    bounded_unrolled_list<int, 8, CountingAllocator<int>> list(4);
+    for (int i = 0; i < 32; ++i) {
+        list.push_back(i);
+    }
+    const int allocations = AllocationCounter::Allocations;
+
+    for (int i = 0; i < 10'000; ++i) {
+        list.push_back(i);
+        if (i % 7 == 0) list.pop_front();
+    }
+    list.clear();
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(AllocationCounter::Allocations, allocations);
+    ASSERT_EQ(list.node_count(), 4);
+}
@@ -0,0 +1,131 @@
+#include <epoch_domain.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Tracked {
+    static inline std::atomic<int> Alive = 0;
+
+    explicit Tracked(int value) : Value(value) { ++Alive; }
+    ~Tracked() {
+        Value = -1;
+        --Alive;
+    }
+
+    int Value;
+};
+
+}  // namespace
+
+/*
+    Объект, снятый с публикации, не освобождается, пока есть поток,
+    закрепившийся в эпохе до его удаления
+*/
+TEST(EpochDomain, retireWaitsForPinnedReaders) {
+    epoch_domain domain;
+    auto writer = domain.register_thread();
+    auto reader = domain.register_thread();
+
+    {
+        auto guard = reader.pin();
+        writer.retire(new Tracked(1));
+        ASSERT_EQ(writer.reclaim(), 0);
+        ASSERT_EQ(Tracked::Alive.load(), 1);
+    }
+
+    ASSERT_EQ(writer.reclaim(), 1);
+    ASSERT_EQ(writer.pending(), 0);
+    ASSERT_EQ(Tracked::Alive.load(), 0);
+}
+
+/*
+    Удалённые объекты отсоединившегося потока освобождаются доменом
+*/
+TEST(EpochDomain, orphansAreReclaimed) {
+    {
+        epoch_domain domain;
+        auto reader = domain.register_thread();
+        auto guard = reader.pin();
+        {
+            auto writer = domain.register_thread();
+            writer.retire(new Tracked(1));
+            writer.retire(new Tracked(2));
+        }
+        ASSERT_EQ(domain.reclaim_orphans(), 0);
+        ASSERT_EQ(Tracked::Alive.load(), 2);
+    }
+    ASSERT_EQ(Tracked::Alive.load(), 0);
+}
+
+/*
+    Стресс-тест: читатели постоянно читают разделяемый указатель,
+    писатель подменяет его и отдаёт старый объект на освобождение.
+    Читатель не должен увидеть уже разрушенный объект
+*/
+TEST(EpochDomain, stress) {
+    constexpr int kUpdates = 20000;
+    epoch_domain domain(16);
+    std::atomic<Tracked*> shared = new Tracked(0);
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            auto participant = domain.register_thread();
+            while (!done.load()) {
+                auto guard = participant.pin();
+                Tracked* current = shared.load(std::memory_order_seq_cst);
+                if (current->Value < 0) consistent = false;
+            }
+        });
+    }
+
+    {
+        auto writer = domain.register_thread();
+        for (int i = 1; i <= kUpdates; ++i) {
+            Tracked* old = shared.exchange(new Tracked(i));
+            writer.retire(old);
+        }
+        done = true;
+        for (auto& thread : readers) {
+            thread.join();
+        }
+        writer.reclaim();
+        ASSERT_EQ(writer.pending(), 0);
+    }
+
+    ASSERT_TRUE(consistent.load());
+    delete shared.load();
+    ASSERT_EQ(Tracked::Alive.load(), 0);
+}
+
+/*
+    Освобождение через аллокатор: объекты разрушаются и возвращаются
+    в аллокатор пачками по batch_size
+*/
+TEST(EpochDomain, retireThroughAllocator) {
+    std::allocator<Tracked> alloc;
+    epoch_domain domain(4);
+    auto writer = domain.register_thread();
+
+    for (int i = 0; i < 3; ++i) {
+        Tracked* p = alloc.allocate(1);
+        std::construct_at(p, i);
+        writer.retire_allocated(alloc, p);
+    }
+    ASSERT_EQ(writer.pending(), 3);
+    ASSERT_EQ(Tracked::Alive.load(), 3);
+
+    Tracked* p = alloc.allocate(1);
+    std::construct_at(p, 3);
+    writer.retire_allocated(alloc, p);
+    ASSERT_EQ(writer.pending(), 0);
+    ASSERT_EQ(Tracked::Alive.load(), 0);
+}
@@ -185,3 +185,197 @@ TEST_F(ExceptionSafetyTest, failesAtPushBack) {
     ASSERT_EQ(unrolled_list.begin()->Name, std::string("first"));
     ASSERT_EQ((++unrolled_list.begin())->Name, std::string("second"));
 }
+
+/*
+    append_range копирует элементы прямо в ноды списка.
+    Если копирование падает, список возвращается к исходному состоянию,
+    а все созданные для добавления ноды освобождаются.
+    Во втором случае исключение летит посреди ноды, в которую
+    часть элементов уже скопирована.
+*/
+TEST_F(ExceptionSafetyTest, failesAtAppendRange) {
+    std::vector<SomeObj> values(20);
+    TestAllocator<SomeObj> allocator;
+    using unrolled_list_type = unrolled_list<SomeObj, 4, TestAllocator<SomeObj>>;
+
+    {
+        unrolled_list_type ul(allocator);
+        ul.emplace_back();
+        ul.emplace_back();
+        SomeObj::CopiesCount = 0;
+        SomeObj::DestructorCalled = 0;
+
+        ASSERT_ANY_THROW(ul.append_range(values));
+
+        ASSERT_EQ(ul.size(), 2);
+        ASSERT_EQ(std::distance(ul.begin(), ul.end()), 2);
+        ASSERT_EQ(SomeObj::DestructorCalled, 2);
+    }
+
+    {
+        unrolled_list_type ul(allocator);
+        ul.emplace_back();
+        SomeObj::CopiesCount = 0;
+        SomeObj::DestructorCalled = 0;
+
+        ASSERT_ANY_THROW(ul.append_range(values));
+
+        ASSERT_EQ(ul.size(), 1);
+        ASSERT_EQ(std::distance(ul.begin(), ul.end()), 1);
+        ASSERT_EQ(SomeObj::DestructorCalled, 2);
+    }
+
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, TestAllocator<NodeTag>::DeallocationCount);
+    ASSERT_EQ(TestAllocator<NodeTag>::ElementsAllocated, TestAllocator<NodeTag>::ElementsDeallocated);
+}
+
+/*
+    insert_batch даёт базовую гарантию: после исключения список остаётся
+    корректным, а его размер совпадает с числом элементов при обходе.
+    Элементы ноды, которую не удалось перестроить, сохраняют свои значения
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertBatch) {
+    unrolled_list<BadOrGood, 4> unrolled_list;
+    for (int i = 0; i < 10; ++i) {
+        unrolled_list.push_back(Good{.Name = std::to_string(i)});
+    }
+
+    std::vector<std::pair<size_t, Good>> good_batch = {{0, Good{"a"}}, {5, Good{"b"}}};
+    unrolled_list.insert_batch(good_batch.begin(), good_batch.end());
+    ASSERT_EQ(unrolled_list.size(), 12);
+
+    std::vector<std::string> names;
+    for (const BadOrGood& value : unrolled_list) {
+        names.push_back(value.Name);
+    }
+
+    std::vector<std::pair<size_t, Bad>> bad_batch = {{4, Bad{}}};
+    ASSERT_ANY_THROW(unrolled_list.insert_batch(bad_batch.begin(), bad_batch.end()));
+    ASSERT_EQ(std::distance(unrolled_list.begin(), unrolled_list.end()), unrolled_list.size());
+    ASSERT_EQ(unrolled_list.size(), 12);
+
+    std::vector<std::string> names_after;
+    for (const BadOrGood& value : unrolled_list) {
+        names_after.push_back(value.Name);
+    }
+    ASSERT_EQ(names_after, names);
+}
+
+struct ThrowingMove {
+    static inline int Alive = 0;
+    static inline int MovesLeft = 0;
+    static inline int CopiesLeft = -1;
+
+    explicit ThrowingMove(int value) : Value(value) { ++Alive; }
+    ThrowingMove(const ThrowingMove& other) : Value(other.Value) {
+        if (CopiesLeft-- == 0) {
+            throw std::runtime_error("");
+        }
+        ++Alive;
+    }
+    ThrowingMove(ThrowingMove&& other) : Value(other.Value) {
+        if (MovesLeft-- == 0) {
+            throw std::runtime_error("");
+        }
+        ++Alive;
+    }
+    ~ThrowingMove() {
+        --Alive;
+        Value = -1;
+    }
+
+    int Value;
+};
+
+static std::vector<int> Values(const unrolled_list<ThrowingMove, 4>& list) {
+    std::vector<int> values;
+    for (const ThrowingMove& value : list) {
+        values.push_back(value.Value);
+    }
+    return values;
+}
+
+static unrolled_list<ThrowingMove, 4> MakeThrowingMoveList(int from, int count) {
+    std::vector<ThrowingMove> values;
+    values.reserve(count);
+    for (int i = from; i < from + count; ++i) {
+        values.emplace_back(i);
+    }
+    std::span<const ThrowingMove> source(values);
+    return unrolled_list<ThrowingMove, 4>(source);
+}
+
+/*
+    Для T с бросающим перемещением erase_indices копирует оставшиеся элементы
+    ноды в новую ноду. Если копирование бросает, уже обработанные ноды
+    остаются без удалённых элементов, а остальные элементы не теряются
+*/
+TEST_F(ExceptionSafetyTest, failesAtEraseIndices) {
+    ThrowingMove::CopiesLeft = -1;
+    {
+        auto unrolled_list = MakeThrowingMoveList(0, 8);
+
+        ThrowingMove::MovesLeft = 0;
+        ThrowingMove::CopiesLeft = 4;
+        std::vector<size_t> indices = {1, 5};
+        ASSERT_ANY_THROW(unrolled_list.erase_indices(indices.begin(), indices.end()));
+        ASSERT_EQ(std::distance(unrolled_list.begin(), unrolled_list.end()), unrolled_list.size());
+        ASSERT_EQ(ThrowingMove::Alive, unrolled_list.size());
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(0, 2, 3, 4, 5, 6, 7));
+
+        ThrowingMove::CopiesLeft = -1;
+        indices = {0, 4};
+        ASSERT_EQ(unrolled_list.erase_indices(indices.begin(), indices.end()), 2);
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(2, 3, 4, 6, 7));
+        ASSERT_EQ(ThrowingMove::Alive, unrolled_list.size());
+    }
+    ASSERT_EQ(ThrowingMove::Alive, 0);
+}
+
+/*
+    splice в середину ноды делит её. Если копирование хвоста ноды бросает,
+    оба списка не меняются и новая нода не теряется
+*/
+TEST_F(ExceptionSafetyTest, failesAtSplice) {
+    ThrowingMove::CopiesLeft = -1;
+    {
+        auto unrolled_list = MakeThrowingMoveList(0, 8);
+        auto other = MakeThrowingMoveList(10, 2);
+
+        ThrowingMove::MovesLeft = 1;
+        ThrowingMove::CopiesLeft = 1;
+        ASSERT_ANY_THROW(unrolled_list.splice(std::next(unrolled_list.begin()), other));
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
+        ASSERT_THAT(Values(other), ::testing::ElementsAre(10, 11));
+        ASSERT_EQ(unrolled_list.size(), 8);
+        ASSERT_EQ(ThrowingMove::Alive, 10);
+
+        ThrowingMove::CopiesLeft = -1;
+        unrolled_list.splice(std::next(unrolled_list.begin()), other);
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(0, 10, 11, 1, 2, 3, 4, 5, 6, 7));
+        ASSERT_TRUE(other.empty());
+    }
+    ASSERT_EQ(ThrowingMove::Alive, 0);
+}
+
+/*
+    rotate делит ноду в позиции middle. Если копирование хвоста ноды бросает,
+    порядок элементов не меняется
+*/
+TEST_F(ExceptionSafetyTest, failesAtRotate) {
+    ThrowingMove::CopiesLeft = -1;
+    {
+        auto unrolled_list = MakeThrowingMoveList(0, 8);
+
+        ThrowingMove::MovesLeft = 1;
+        ThrowingMove::CopiesLeft = 1;
+        ASSERT_ANY_THROW(unrolled_list.rotate_left(5));
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
+        ASSERT_EQ(ThrowingMove::Alive, 8);
+
+        ThrowingMove::CopiesLeft = -1;
+        unrolled_list.rotate_left(5);
+        ASSERT_THAT(Values(unrolled_list), ::testing::ElementsAre(5, 6, 7, 0, 1, 2, 3, 4));
+    }
+    ASSERT_EQ(ThrowingMove::Alive, 0);
+}
@@ -0,0 +1,133 @@
+#include <flat_unrolled_map.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace {
+
+struct ElementCounter {
+    static inline int Constructed = 0;
+    static inline int Destroyed = 0;
+};
+
+template <typename T>
+struct ConstructingAllocator : std::allocator<T> {
+    using value_type = T;
+
+    ConstructingAllocator() = default;
+    template <typename U>
+    ConstructingAllocator(const ConstructingAllocator<U>&) {}
+
+    template <typename U>
+    struct rebind {
+        using other = ConstructingAllocator<U>;
+    };
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ++ElementCounter::Constructed;
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+    template <typename U>
+    void destroy(U* p) {
+        ++ElementCounter::Destroyed;
+        p->~U();
+    }
+};
+
+}  // namespace
+
+TEST(FlatUnrolledMap, randomOperationsMatchStdMap) {
+    flat_unrolled_map<int, int, 4> map;
+    std::map<int, int> std_map;
+    std::mt19937 gen(11);
+
+    for (int step = 0; step < 5000; ++step) {
+        int key = static_cast<int>(gen() % 300);
+        if (gen() % 3 == 0) {
+            ASSERT_EQ(map.erase(key), std_map.erase(key));
+        } else {
+            auto [it, inserted] = map.try_emplace(key, step);
+            auto [std_it, std_inserted] = std_map.try_emplace(key, step);
+            ASSERT_EQ(inserted, std_inserted);
+            ASSERT_EQ(it->second, std_it->second);
+        }
+        ASSERT_EQ(map.size(), std_map.size());
+    }
+
+    auto std_it = std_map.begin();
+    for (auto [key, value] : map) {
+        ASSERT_EQ(key, std_it->first);
+        ASSERT_EQ(value, std_it->second);
+        ++std_it;
+    }
+    ASSERT_EQ(std_it, std_map.end());
+
+    for (int key = -1; key <= 300; ++key) {
+        ASSERT_EQ(map.contains(key), std_map.contains(key));
+        auto it = map.lower_bound(key);
+        auto expected = std_map.lower_bound(key);
+        if (expected == std_map.end()) {
+            ASSERT_EQ(it, map.end());
+        } else {
+            ASSERT_EQ(it.key(), expected->first);
+        }
+    }
+}
+
+TEST(FlatUnrolledMap, stringKeysAndValues) {
+    flat_unrolled_map<std::string, std::string, 4> map;
+    for (int i = 0; i < 50; ++i) {
+        map[std::to_string(i)] = "value" + std::to_string(i);
+    }
+    map["7"] += "!";
+
+    ASSERT_EQ(map.size(), 50);
+    ASSERT_EQ(map.at("7"), "value7!");
+    ASSERT_THROW(map.at("x"), std::out_of_range);
+
+    std::string previous;
+    for (const auto& [key, value] : map) {
+        ASSERT_LT(previous, key);
+        previous = key;
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_EQ(map.erase(std::to_string(i)), 1);
+    }
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(map.node_count(), 0);
+}
+
+TEST(FlatUnrolledMap, descendingCompare) {
+    flat_unrolled_map<int, char, 4, std::greater<int>> map = {
+        {1, 'a'}, {5, 'e'}, {3, 'c'}, {4, 'd'}, {2, 'b'}, {6, 'f'}};
+
+    std::string values;
+    for (auto [key, value] : map) {
+        values += value;
+    }
+    ASSERT_EQ(values, "fedcba");
+    ASSERT_EQ(map.find(4)->second, 'd');
+}
+
+TEST(FlatUnrolledMap, elementsGoThroughAllocator) {
+    {
+        flat_unrolled_map<int, std::string, 4, std::less<int>,
+                          ConstructingAllocator<std::pair<const int, std::string>>>
+            map;
+        for (int i = 0; i < 100; ++i) {
+            map.try_emplace(i * 7 % 100, std::to_string(i));
+        }
+        for (int i = 0; i < 50; ++i) {
+            map.erase(i);
+        }
+        ASSERT_GT(ElementCounter::Constructed, 200);
+    }
+    ASSERT_EQ(ElementCounter::Constructed, ElementCounter::Destroyed);
+}
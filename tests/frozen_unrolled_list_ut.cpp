@@ -0,0 +1,57 @@
+#include <unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+TEST(FrozenUnrolledList, freezeAndIndex) {
+    unrolled_list<int, 4> list;
+    for (int i = 0; i < 30; ++i) {
+        list.push_back(i);
+    }
+    list.erase(list.begin());
+
+    auto frozen = list.freeze();
+    ASSERT_EQ(frozen.size(), 29);
+    ASSERT_EQ(list.size(), 29);
+    for (int i = 0; i < 29; ++i) {
+        ASSERT_EQ(frozen[i], i + 1);
+    }
+    ASSERT_EQ(frozen.front(), 1);
+    ASSERT_EQ(frozen.back(), 29);
+    ASSERT_THROW(frozen.at(29), std::out_of_range);
+    ASSERT_THAT(frozen, ::testing::ElementsAreArray(list.to_vector()));
+    ASSERT_EQ(frozen.end() - frozen.begin(), 29);
+}
+
+TEST(FrozenUnrolledList, freezeMovesElements) {
+    unrolled_list<std::string, 4> list;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(std::string(32, 'a' + i));
+        expected.push_back(std::string(32, 'a' + i));
+    }
+
+    auto frozen = std::move(list).freeze();
+    ASSERT_TRUE(list.empty());
+    ASSERT_THAT(frozen, ::testing::ElementsAreArray(expected));
+
+    auto thawed = std::move(frozen).thaw();
+    ASSERT_TRUE(frozen.empty());
+    ASSERT_THAT(thawed, ::testing::ElementsAreArray(expected));
+
+    thawed.push_back("tail");
+    expected.push_back("tail");
+    ASSERT_THAT(thawed.freeze().thaw(), ::testing::ElementsAreArray(expected));
+}
+
+TEST(FrozenUnrolledList, empty) {
+    unrolled_list<int, 4> list;
+    auto frozen = list.freeze();
+    ASSERT_TRUE(frozen.empty());
+    ASSERT_EQ(frozen.begin(), frozen.end());
+    ASSERT_THROW(frozen.front(), std::out_of_range);
+    ASSERT_TRUE(frozen.thaw().empty());
+}
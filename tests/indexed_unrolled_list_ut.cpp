@@ -0,0 +1,167 @@
+#include <indexed_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+struct Order {
+    int id;
+    std::string name;
+};
+
+struct OrderId {
+    int operator()(const Order& order) const { return order.id; }
+};
+
+}  // namespace
+
+TEST(IndexedUnrolledList, findAfterSplits) {
+    indexed_unrolled_list<int, 4> list;
+    std::list<int> std_list;
+    std::mt19937 gen(7);
+
+    for (int i = 0; i < 500; ++i) {
+        size_t offset = std_list.empty() ? 0 : gen() % (std_list.size() + 1);
+        auto std_it = std::next(std_list.begin(), offset);
+        auto it = std::next(list.begin(), offset);
+        std_list.insert(std_it, i);
+        ASSERT_TRUE(list.insert(it, i).second);
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_list));
+
+    for (int i = 0; i < 500; ++i) {
+        auto it = list.find(i);
+        ASSERT_NE(it, list.end());
+        ASSERT_EQ(*it, i);
+    }
+    ASSERT_EQ(list.find(500), list.end());
+    ASSERT_FALSE(list.contains(-1));
+}
+
+TEST(IndexedUnrolledList, eraseAndReinsert) {
+    indexed_unrolled_list<int, 4> list;
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_FALSE(list.push_back(5).second);
+    ASSERT_EQ(list.size(), 100);
+
+    for (int i = 0; i < 100; i += 2) {
+        ASSERT_EQ(list.erase(i), 1);
+    }
+    ASSERT_EQ(list.erase(0), 0);
+    ASSERT_EQ(list.size(), 50);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(list.contains(i), i % 2 == 1);
+    }
+
+    for (int i = 0; i < 100; i += 2) {
+        list.push_front(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(*list.find(i), i);
+    }
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_FALSE(list.contains(1));
+}
+
+TEST(IndexedUnrolledList, keyExtractor) {
+    indexed_unrolled_list<Order, 4, OrderId> orders;
+    for (int i = 0; i < 20; ++i) {
+        orders.push_back({i * 3, "order" + std::to_string(i)});
+    }
+
+    auto it = orders.find(9);
+    ASSERT_NE(it, orders.end());
+    ASSERT_EQ(it->name, "order3");
+    ASSERT_EQ(orders.find(10), orders.end());
+
+    orders.erase(it);
+    ASSERT_FALSE(orders.contains(9));
+    ASSERT_EQ(orders.size(), 19);
+}
+
+namespace {
+
+struct CountedKey {
+    static inline int Comparisons = 0;
+
+    long long value;
+
+    friend bool operator==(const CountedKey& lhs, const CountedKey& rhs) {
+        ++Comparisons;
+        return lhs.value == rhs.value;
+    }
+};
+
+struct IdentityHash {
+    size_t operator()(const CountedKey& key) const {
+        return static_cast<size_t>(key.value);
+    }
+};
+
+struct ThrowingCopy {
+    static inline bool Throw = false;
+
+    int id;
+
+    explicit ThrowingCopy(int id) : id(id) {}
+    ThrowingCopy(const ThrowingCopy& other) : id(other.id) {
+        if (Throw) throw std::runtime_error("");
+    }
+    ThrowingCopy(ThrowingCopy&&) noexcept = default;
+};
+
+struct ThrowingCopyId {
+    int operator()(const ThrowingCopy& value) const { return value.id; }
+};
+
+}  // namespace
+
+/*
+    Ключи с общими младшими битами не должны собираться в одну цепочку
+    проб, даже если хеш -- тождественная функция
+*/
+TEST(IndexedUnrolledList, stridedKeys) {
+    indexed_unrolled_list<CountedKey, 16, std::identity, IdentityHash> list;
+    CountedKey::Comparisons = 0;
+    for (long long i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(list.push_back({i << 20}).second);
+    }
+    for (long long i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(list.contains({i << 20}));
+    }
+    ASSERT_LT(CountedKey::Comparisons, 40000);
+}
+
+/*
+    Если копирование бросает уже после деления ноды, индекс указывает
+    на ноды, в которых элементы действительно лежат
+*/
+TEST(IndexedUnrolledList, insertThrowKeepsIndex) {
+    indexed_unrolled_list<ThrowingCopy, 4, ThrowingCopyId> list;
+    ThrowingCopy::Throw = false;
+    for (int i = 0; i < 4; ++i) {
+        list.push_back(ThrowingCopy(i));
+    }
+
+    ThrowingCopy::Throw = true;
+    ASSERT_ANY_THROW(list.push_back(ThrowingCopy(10)));
+    ThrowingCopy::Throw = false;
+
+    ASSERT_EQ(list.size(), 4);
+    ASSERT_FALSE(list.contains(10));
+    for (int i = 0; i < 4; ++i) {
+        auto it = list.find(i);
+        ASSERT_NE(it, list.end());
+        ASSERT_EQ(it->id, i);
+    }
+}
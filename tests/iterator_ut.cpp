@@ -0,0 +1,132 @@
+#include <unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <list>
+#include <vector>
+
+/*
+    Тесты проверяют обход контейнера итераторами в обе стороны,
+    в том числе переходы через границы нод и через end()
+*/
+
+TEST(Iterator, forwardAndBackward) {
+    std::list<int> std_list;
+    unrolled_list<int, 4> unrolled_list;
+
+    for (int i = 0; i < 37; ++i) {
+        std_list.push_back(i);
+        unrolled_list.push_back(i);
+    }
+
+    auto std_it = std_list.begin();
+    for (auto it = unrolled_list.begin(); it != unrolled_list.end(); ++it, ++std_it) {
+        ASSERT_EQ(*it, *std_it);
+    }
+
+    auto it = unrolled_list.end();
+    for (auto std_rit = std_list.rbegin(); std_rit != std_list.rend(); ++std_rit) {
+        --it;
+        ASSERT_EQ(*it, *std_rit);
+    }
+    ASSERT_EQ(it, unrolled_list.begin());
+}
+
+TEST(Iterator, find) {
+    unrolled_list<int, 5> unrolled_list;
+    for (int i = 0; i < 100; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    auto it = std::find(unrolled_list.cbegin(), unrolled_list.cend(), 42);
+    ASSERT_NE(it, unrolled_list.cend());
+    ASSERT_EQ(*it, 42);
+    ASSERT_EQ(std::distance(unrolled_list.cbegin(), it), 42);
+
+    ASSERT_EQ(std::find(unrolled_list.cbegin(), unrolled_list.cend(), 100), unrolled_list.cend());
+}
+
+/*
+    Удаляется последний элемент ноды, которая не является хвостом.
+    Итератор, который вернул erase, должен указывать на первый элемент следующей ноды
+*/
+TEST(Iterator, eraseAtNodeBoundary) {
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 8; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    auto it = unrolled_list.begin();
+    std::advance(it, 3);
+    it = unrolled_list.erase(it);
+
+    ASSERT_NE(it, unrolled_list.end());
+    ASSERT_EQ(*it, 4);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAre(0, 1, 2, 4, 5, 6, 7));
+}
+
+TEST(Iterator, reverse) {
+    std::list<int> std_list;
+    unrolled_list<int, 4> unrolled_list;
+
+    for (int i = 0; i < 37; ++i) {
+        std_list.push_front(i);
+        unrolled_list.push_front(i);
+    }
+
+    ASSERT_TRUE(std::equal(unrolled_list.rbegin(), unrolled_list.rend(),
+                           std_list.rbegin(), std_list.rend()));
+
+    const auto& const_list = unrolled_list;
+    ASSERT_TRUE(std::equal(const_list.crbegin(), const_list.crend(),
+                           std_list.crbegin(), std_list.crend()));
+
+    auto rit = unrolled_list.rend();
+    for (int value : std_list) {
+        --rit;
+        ASSERT_EQ(*rit, value);
+    }
+    ASSERT_EQ(rit, unrolled_list.rbegin());
+}
+
+/*
+    base() обратного итератора указывает на элемент, следующий за ним,
+    а конструирование обратного итератора от прямого даёт предыдущий элемент
+*/
+TEST(Iterator, reverseBase) {
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 10; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    ASSERT_EQ(unrolled_list.rbegin().base(), unrolled_list.end());
+    ASSERT_EQ(unrolled_list.rend().base(), unrolled_list.begin());
+
+    for (auto it = unrolled_list.begin(); it != unrolled_list.end(); ++it) {
+        decltype(unrolled_list)::reverse_iterator rit(it);
+        ASSERT_EQ(rit.base(), it);
+        if (it == unrolled_list.begin()) {
+            ASSERT_EQ(rit, unrolled_list.rend());
+        } else {
+            ASSERT_EQ(*rit, *it - 1);
+        }
+    }
+}
+
+TEST(Iterator, reverseSegments) {
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 37; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    std::vector<int> reversed;
+    unrolled_list.for_each_segment_reverse([&](std::span<const int> segment) {
+        ASSERT_FALSE(segment.empty());
+        ASSERT_LE(segment.size(), 4);
+        reversed.insert(reversed.end(), segment.rbegin(), segment.rend());
+    });
+
+    ASSERT_THAT(reversed, ::testing::ElementsAreArray(unrolled_list.rbegin(), unrolled_list.rend()));
+}
@@ -0,0 +1,113 @@
+#include <magazine_allocator.h>
+#include <unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <thread>
+#include <vector>
+
+using magazine_list = unrolled_list<int, 8, magazine_allocator<int, 4>>;
+
+TEST(MagazineAllocator, behavesLikeList) {
+    std::list<int> std_list;
+    magazine_list list;
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            std_list.push_back(i);
+            list.push_back(i);
+        } else {
+            std_list.push_front(i);
+            list.push_front(i);
+        }
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_list));
+
+    for (int i = 0; i < 500; ++i) {
+        std_list.pop_back();
+        list.pop_back();
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_list));
+}
+
+/*
+    Несколько потоков одновременно строят и разрушают свои списки
+*/
+TEST(MagazineAllocator, concurrentBuildAndDestroy) {
+    std::vector<std::thread> threads;
+    std::vector<int> sums(8);
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([t, &sums] {
+            for (int round = 0; round < 20; ++round) {
+                magazine_list list;
+                for (int i = 0; i < 500; ++i) {
+                    list.push_back(i);
+                }
+                int sum = 0;
+                for (int value : list) {
+                    sum += value;
+                }
+                sums[t] = sum;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_THAT(sums, ::testing::Each(499 * 500 / 2));
+}
+
+/*
+    Список строится в одном потоке, а разрушается в другом:
+    ноды возвращаются в кэш потока, который их освобождает
+*/
+TEST(MagazineAllocator, crossThreadFree) {
+    std::vector<magazine_list> lists(4);
+    std::thread producer([&lists] {
+        for (auto& list : lists) {
+            for (int i = 0; i < 1000; ++i) {
+                list.push_back(i);
+            }
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&lists] {
+        for (auto& list : lists) {
+            ASSERT_EQ(list.size(), 1000);
+            list.clear();
+        }
+    });
+    consumer.join();
+
+    for (const auto& list : lists) {
+        ASSERT_TRUE(list.empty());
+    }
+}
+
+/*
+    Объект thread_local, созданный раньше кэша потока, освобождает
+    память уже после разрушения кэша: блок уходит в общий пул
+*/
+TEST(MagazineAllocator, freeAfterThreadCacheDestroyed) {
+    using allocator = magazine_allocator<int, 4>;
+    struct late_owner {
+        int* p = nullptr;
+        ~late_owner() {
+            if (p) allocator().deallocate(p, 1);
+        }
+    };
+
+    std::thread thread([] {
+        static thread_local late_owner owner;
+        owner.p = allocator().allocate(1);
+        *owner.p = 42;
+    });
+    thread.join();
+
+    int* p = allocator().allocate(1);
+    *p = 7;
+    allocator().deallocate(p, 1);
+}
@@ -0,0 +1,111 @@
+#include <node_arena.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <span>
+#include <string>
+#include <vector>
+
+/*
+    Несколько списков используют одну арену.
+    Ноды, освобождённые одним списком, переиспользуются другим,
+    поэтому количество слэбов не растёт
+*/
+TEST(NodeArena, sharedBetweenLists) {
+    node_arena<int, 4> arena(8);
+    std::vector<node_arena<int, 4>::list_type> lists;
+    for (int i = 0; i < 10; ++i) {
+        lists.push_back(arena.make_list());
+    }
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 10; ++i) {
+            for (int j = 0; j < 8; ++j) {
+                lists[i].push_back(i * 100 + j);
+            }
+        }
+        size_t nodes = 0;
+        for (auto& list : lists) {
+            list.for_each_segment([&](std::span<const int>) { ++nodes; });
+        }
+        ASSERT_EQ(arena.nodes_in_use(), nodes);
+        for (auto& list : lists) {
+            list.clear();
+        }
+    }
+
+    ASSERT_EQ(arena.nodes_in_use(), 0);
+    ASSERT_LE(arena.capacity(), 40);
+}
+
+TEST(NodeArena, behavesLikeList) {
+    node_arena<std::string, 3> arena(4);
+    std::list<std::string> std_list;
+    auto list = arena.make_list();
+
+    for (int i = 0; i < 50; ++i) {
+        if (i % 3 == 0) {
+            std_list.push_front(std::to_string(i));
+            list.push_front(std::to_string(i));
+        } else {
+            std_list.push_back(std::to_string(i));
+            list.push_back(std::to_string(i));
+        }
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_list));
+    ASSERT_EQ(list.get_allocator(), arena.get_allocator());
+
+    auto copy = list;
+    ASSERT_EQ(copy, list);
+}
+
+TEST(NodeArena, release) {
+    node_arena<int, 4> arena(16);
+    {
+        auto list = arena.make_list();
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i);
+        }
+        ASSERT_GT(arena.slabs_allocated(), 1);
+    }
+    arena.release();
+
+    ASSERT_EQ(arena.slabs_allocated(), 0);
+    ASSERT_EQ(arena.capacity(), 0);
+
+    auto list = arena.make_list();
+    list.push_back(1);
+    ASSERT_EQ(arena.slabs_allocated(), 1);
+}
+
+/*
+    release() освобождает слэбы вместе с нодами живых списков.
+    После abandon() такие списки пусты и снова берут ноды из арены
+*/
+TEST(NodeArena, releaseWithLiveLists) {
+    node_arena<int, 4> arena(16);
+    std::vector<node_arena<int, 4>::list_type> lists;
+    for (int i = 0; i < 3; ++i) {
+        lists.push_back(arena.make_list());
+        for (int j = 0; j < 100; ++j) {
+            lists[i].push_back(j);
+        }
+    }
+    ASSERT_GT(arena.nodes_in_use(), 0);
+
+    arena.release();
+    ASSERT_EQ(arena.slabs_allocated(), 0);
+    ASSERT_EQ(arena.nodes_in_use(), 0);
+
+    for (auto& list : lists) {
+        list.abandon();
+        ASSERT_TRUE(list.empty());
+        ASSERT_EQ(list.begin(), list.end());
+    }
+    lists[0].push_back(1);
+    ASSERT_THAT(lists[0], ::testing::ElementsAre(1));
+    ASSERT_EQ(arena.nodes_in_use(), 1);
+    ASSERT_EQ(arena.slabs_allocated(), 1);
+}
@@ -0,0 +1,91 @@
+#include <rcu_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(RcuUnrolledList, updateAndRead) {
+    rcu_unrolled_list<int, 4> rcu(unrolled_list<int, 4>{1, 2, 3});
+    auto reader = rcu.make_reader();
+
+    {
+        auto snapshot = reader.read();
+        ASSERT_THAT(*snapshot, ::testing::ElementsAre(1, 2, 3));
+    }
+
+    rcu.update([](auto& list) { list.push_back(4); });
+
+    auto snapshot = reader.read();
+    ASSERT_THAT(*snapshot, ::testing::ElementsAre(1, 2, 3, 4));
+}
+
+/*
+    Пока читатель держит снимок, старая версия не освобождается и не меняется.
+    После того как снимок отпущен, старая версия освобождается на следующей публикации
+*/
+TEST(RcuUnrolledList, snapshotOutlivesPublish) {
+    rcu_unrolled_list<int, 4> rcu(unrolled_list<int, 4>{1, 2, 3});
+    auto reader = rcu.make_reader();
+
+    {
+        auto snapshot = reader.read();
+        rcu.publish(unrolled_list<int, 4>{4, 5});
+        rcu.publish(unrolled_list<int, 4>{6});
+
+        ASSERT_THAT(*snapshot, ::testing::ElementsAre(1, 2, 3));
+        ASSERT_EQ(rcu.pending_reclaim(), 2);
+    }
+
+    rcu.reclaim();
+    ASSERT_EQ(rcu.pending_reclaim(), 0);
+
+    auto snapshot = reader.read();
+    ASSERT_THAT(*snapshot, ::testing::ElementsAre(6));
+}
+
+/*
+    Читатели постоянно берут снимки, пока писатель публикует новые версии.
+    Каждая версия состоит из одинаковых элементов, равных номеру версии,
+    поэтому любой снимок должен быть согласованным
+*/
+TEST(RcuUnrolledList, concurrentReadersAndWriter) {
+    constexpr int kVersions = 200;
+    constexpr int kSize = 100;
+    rcu_unrolled_list<int, 8> rcu(unrolled_list<int, 8>(kSize, 0));
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            auto reader = rcu.make_reader();
+            while (!done.load()) {
+                auto snapshot = reader.read();
+                int version = snapshot->front();
+                if (snapshot->size() != kSize) consistent = false;
+                for (int value : *snapshot) {
+                    if (value != version) consistent = false;
+                }
+            }
+        });
+    }
+
+    for (int version = 1; version <= kVersions; ++version) {
+        rcu.update([version](auto& list) {
+            for (int& value : list) {
+                value = version;
+            }
+        });
+    }
+    done = true;
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(consistent.load());
+    rcu.reclaim();
+    ASSERT_EQ(rcu.pending_reclaim(), 0);
+}
@@ -0,0 +1,86 @@
+#include <sharded_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST(ShardedUnrolledList, concurrentPushBack) {
+    sharded_unrolled_list<int, 4> list(3);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 6; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < 1000; ++i) {
+                list.push_back(t * 1000 + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(list.size(), 6000);
+    std::vector<int> values(list.begin(), list.end());
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 6000; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+/*
+    collapse переносит узлы всех шардов в один список без копирования
+    элементов и оставляет шарды пустыми
+*/
+TEST(ShardedUnrolledList, collapse) {
+    sharded_unrolled_list<int, 4> list(4);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < 10; ++i) {
+                list.push_back(t * 10 + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto merged = list.collapse();
+    ASSERT_EQ(merged.size(), 40);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+
+    std::vector<int> values(merged.begin(), merged.end());
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 40; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+
+    list.push_back(100);
+    ASSERT_THAT(list, ::testing::ElementsAre(100));
+}
+
+TEST(ShardedUnrolledList, forEach) {
+    sharded_unrolled_list<int, 4> list(2);
+    for (int i = 0; i < 9; ++i) {
+        list.push_back(i);
+    }
+
+    int sum = 0;
+    list.for_each([&sum](int value) { sum += value; });
+    ASSERT_EQ(sum, 36);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8));
+}
+
+TEST(ShardedUnrolledList, shardCount) {
+    for (size_t count : {1, 3, 5, 7, 17}) {
+        sharded_unrolled_list<int, 4> list(count);
+        ASSERT_EQ(list.shard_count(), count);
+    }
+    sharded_unrolled_list<int, 4> list(0);
+    ASSERT_EQ(list.shard_count(), 1);
+}
@@ -3,8 +3,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <vector>
 #include <list>
+#include <random>
+#include <string>
 
 /*
     В данном файле представлен ряд тестов, где используются (вместе, раздельно и по-очереди):
@@ -108,3 +111,236 @@ TEST(UnrolledLinkedList, popFrontBack) {
 
     ASSERT_TRUE(unrolled_list.empty());
 }
+
+TEST(UnrolledLinkedList, splice) {
+    for (int offset = 0; offset <= 20; ++offset) {
+        std::list<int> std_list;
+        std::list<int> std_other;
+        unrolled_list<int, 4> unrolled_list;
+        ::unrolled_list<int, 4> unrolled_other;
+
+        for (int i = 0; i < 20; ++i) {
+            std_list.push_back(i);
+            unrolled_list.push_back(i);
+            std_other.push_back(100 + i);
+            unrolled_other.push_back(100 + i);
+        }
+
+        auto std_it = std_list.begin();
+        auto unrolled_it = unrolled_list.begin();
+        std::advance(std_it, offset);
+        std::advance(unrolled_it, offset);
+        std_list.splice(std_it, std_other);
+        unrolled_list.splice(unrolled_it, unrolled_other);
+
+        ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_list));
+        ASSERT_EQ(unrolled_list.size(), 40);
+        ASSERT_TRUE(unrolled_other.empty());
+        ASSERT_THAT(std::vector<int>(unrolled_list.rbegin(), unrolled_list.rend()),
+                    ::testing::ElementsAreArray(std_list.rbegin(), std_list.rend()));
+    }
+}
+
+TEST(UnrolledLinkedList, contiguousImportExport) {
+    std::vector<int> values;
+    for (int i = 0; i < 23; ++i) {
+        values.push_back(i);
+    }
+
+    unrolled_list<int, 4> unrolled_list(values);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(values));
+    ASSERT_EQ(unrolled_list.to_vector(), values);
+
+    unrolled_list.push_back(23);
+    unrolled_list.append_range(values);
+    std::vector<int> expected = values;
+    expected.push_back(23);
+    expected.insert(expected.end(), values.begin(), values.end());
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(expected));
+    ASSERT_EQ(unrolled_list.size(), expected.size());
+
+    std::vector<int> out(expected.size() + 2, -1);
+    ASSERT_EQ(unrolled_list.copy_to(out), expected.size());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+    ASSERT_EQ(out.back(), -1);
+
+    std::vector<int> prefix(5);
+    ASSERT_EQ(unrolled_list.copy_to(prefix), 5);
+    ASSERT_THAT(prefix, ::testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(UnrolledLinkedList, contiguousImportNonTrivial) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 11; ++i) {
+        values.push_back(std::to_string(i));
+    }
+
+    unrolled_list<std::string, 4> unrolled_list;
+    unrolled_list.push_back("x");
+    unrolled_list.append_range(values);
+
+    std::vector<std::string> expected = {"x"};
+    expected.insert(expected.end(), values.begin(), values.end());
+    ASSERT_EQ(unrolled_list.to_vector(), expected);
+}
+
+TEST(UnrolledLinkedList, insertBatch) {
+    std::mt19937 gen(3);
+    for (int size : {0, 1, 4, 7, 30}) {
+        for (int batch_size : {1, 3, 25}) {
+            unrolled_list<int, 4> unrolled_list;
+            std::vector<int> original;
+            for (int i = 0; i < size; ++i) {
+                unrolled_list.push_back(i);
+                original.push_back(i);
+            }
+
+            std::vector<std::pair<size_t, int>> batch;
+            for (int i = 0; i < batch_size; ++i) {
+                batch.emplace_back(gen() % (size + 1), 1000 + i);
+            }
+            std::stable_sort(batch.begin(), batch.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            std::vector<int> expected;
+            auto next = batch.begin();
+            for (int i = 0; i <= size; ++i) {
+                for (; next != batch.end() && next->first == static_cast<size_t>(i); ++next) {
+                    expected.push_back(next->second);
+                }
+                if (i < size) expected.push_back(original[i]);
+            }
+
+            unrolled_list.insert_batch(batch.begin(), batch.end());
+            ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(expected));
+            ASSERT_EQ(unrolled_list.size(), expected.size());
+            ASSERT_THAT(std::vector<int>(unrolled_list.rbegin(), unrolled_list.rend()),
+                        ::testing::ElementsAreArray(expected.rbegin(), expected.rend()));
+            ASSERT_EQ(unrolled_list.spare_nodes(), 0);
+        }
+    }
+}
+
+TEST(UnrolledLinkedList, eraseIndices) {
+    std::mt19937 gen(4);
+    for (int size : {0, 1, 5, 40}) {
+        for (int count : {0, 1, 10, 60}) {
+            unrolled_list<int, 4> unrolled_list;
+            std::vector<int> values;
+            for (int i = 0; i < size; ++i) {
+                unrolled_list.push_back(i);
+                values.push_back(i);
+            }
+
+            std::vector<size_t> indices;
+            for (int i = 0; i < count; ++i) {
+                indices.push_back(gen() % (size + 2));
+            }
+            std::sort(indices.begin(), indices.end());
+
+            std::vector<int> expected;
+            for (int i = 0; i < size; ++i) {
+                if (!std::binary_search(indices.begin(), indices.end(), static_cast<size_t>(i))) {
+                    expected.push_back(values[i]);
+                }
+            }
+
+            ASSERT_EQ(unrolled_list.erase_indices(indices.begin(), indices.end()),
+                      values.size() - expected.size());
+            ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(expected));
+            ASSERT_EQ(unrolled_list.size(), expected.size());
+            ASSERT_THAT(std::vector<int>(unrolled_list.rbegin(), unrolled_list.rend()),
+                        ::testing::ElementsAreArray(expected.rbegin(), expected.rend()));
+        }
+    }
+}
+
+TEST(UnrolledLinkedList, gatherScatter) {
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 50; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    std::vector<size_t> indices = {0, 3, 3, 4, 17, 48, 49};
+    std::vector<int> gathered(indices.size());
+    unrolled_list.gather(indices, gathered);
+    ASSERT_THAT(gathered, ::testing::ElementsAre(0, 3, 3, 4, 17, 48, 49));
+
+    std::vector<size_t> targets = {1, 4, 49};
+    std::vector<int> values = {-1, -4, -49};
+    unrolled_list.scatter(targets, values);
+    ASSERT_EQ(unrolled_list[1], -1);
+    ASSERT_EQ(unrolled_list[4], -4);
+    ASSERT_EQ(unrolled_list[49], -49);
+    ASSERT_EQ(unrolled_list[2], 2);
+
+    std::vector<size_t> outside = {50};
+    ASSERT_THROW(unrolled_list.gather(outside, std::span<int>(gathered).first(1)), std::out_of_range);
+    ASSERT_THROW(unrolled_list.scatter(targets, std::span<const int>(values).first(2)), std::length_error);
+}
+
+TEST(UnrolledLinkedList, binarySearch) {
+    std::vector<int> values;
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 30; ++i) {
+        values.push_back(i / 3 * 2);
+        unrolled_list.push_back(i / 3 * 2);
+    }
+
+    for (int key = -1; key <= 20; ++key) {
+        auto lower = unrolled_list.lower_bound(key);
+        auto upper = unrolled_list.upper_bound(key);
+        ASSERT_EQ(std::distance(unrolled_list.begin(), lower),
+                  std::lower_bound(values.begin(), values.end(), key) - values.begin());
+        ASSERT_EQ(std::distance(unrolled_list.begin(), upper),
+                  std::upper_bound(values.begin(), values.end(), key) - values.begin());
+    }
+
+    const auto& const_list = unrolled_list;
+    auto point = const_list.partition_point([](int value) { return value < 7; });
+    ASSERT_EQ(*point, 8);
+    ASSERT_EQ(const_list.partition_point([](int) { return true; }), const_list.end());
+    ASSERT_EQ(unrolled_list.lower_bound(10, std::greater<>()), unrolled_list.begin());
+
+    ::unrolled_list<int, 4> empty_list;
+    ASSERT_EQ(empty_list.lower_bound(1), empty_list.end());
+}
+
+TEST(UnrolledLinkedList, rotate) {
+    for (int middle = 0; middle <= 13; ++middle) {
+        std::vector<int> values;
+        unrolled_list<int, 4> unrolled_list;
+        for (int i = 0; i < 13; ++i) {
+            values.push_back(i);
+            unrolled_list.push_back(i);
+        }
+
+        auto expected_it = std::rotate(values.begin(), values.begin() + middle, values.end());
+        auto it = unrolled_list.rotate(std::next(unrolled_list.begin(), middle));
+
+        ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(values));
+        ASSERT_EQ(std::distance(unrolled_list.begin(), it), expected_it - values.begin());
+        ASSERT_THAT(std::vector<int>(unrolled_list.rbegin(), unrolled_list.rend()),
+                    ::testing::ElementsAreArray(values.rbegin(), values.rend()));
+    }
+}
+
+TEST(UnrolledLinkedList, rotateByCount) {
+    std::vector<int> values;
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 10; ++i) {
+        values.push_back(i);
+        unrolled_list.push_back(i);
+    }
+
+    unrolled_list.rotate_left(3);
+    std::rotate(values.begin(), values.begin() + 3, values.end());
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(values));
+
+    unrolled_list.rotate_right(25);
+    std::rotate(values.rbegin(), values.rbegin() + 5, values.rend());
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(values));
+
+    ::unrolled_list<int, 4> empty_list;
+    ASSERT_EQ(empty_list.rotate_left(1), empty_list.end());
+}
@@ -0,0 +1,79 @@
+#include <sliding_window_aggregator.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+
+namespace {
+
+struct Min {
+    int operator()(int lhs, int rhs) const { return std::min(lhs, rhs); }
+};
+
+}  // namespace
+
+/*
+    Окно случайной ширины сравнивается с std::deque, агрегат которого
+    каждый раз пересчитывается заново
+*/
+TEST(SlidingWindowAggregator, matchesRecomputedWindow) {
+    sliding_window_aggregator<int, Min, 4> window;
+    std::deque<int> expected;
+    std::mt19937 gen(11);
+
+    for (int i = 0; i < 5000; ++i) {
+        if (expected.empty() || gen() % 3 != 0) {
+            int value = static_cast<int>(gen() % 1000);
+            window.push_back(value);
+            expected.push_back(value);
+        } else {
+            window.pop_front();
+            expected.pop_front();
+        }
+        ASSERT_EQ(window.size(), expected.size());
+        if (expected.empty()) continue;
+        ASSERT_EQ(window.front(), expected.front());
+        ASSERT_EQ(window.back(), expected.back());
+        ASSERT_EQ(window.aggregate(),
+                  *std::min_element(expected.begin(), expected.end()));
+    }
+}
+
+TEST(SlidingWindowAggregator, fixedWidthSum) {
+    sliding_window_aggregator<long long, std::plus<>, 8> window;
+    for (int i = 1; i <= 1000; ++i) {
+        window.push_back(i);
+        if (window.size() > 100) window.pop_front();
+        int first = std::max(1, i - 99);
+        ASSERT_EQ(window.aggregate(), (1LL * first + i) * (i - first + 1) / 2);
+    }
+}
+
+/*
+    Операция должна быть только ассоциативной: конкатенация строк
+    проверяет, что порядок аргументов сохраняется
+*/
+TEST(SlidingWindowAggregator, keepsOrderOfOperands) {
+    sliding_window_aggregator<std::string, std::plus<>, 3> window;
+    std::string letters = "abcdefghij";
+    for (char c : letters) {
+        window.push_back(std::string(1, c));
+        if (window.size() > 4) window.pop_front();
+    }
+    ASSERT_EQ(window.aggregate(), "ghij");
+    window.pop_front();
+    window.push_back("k");
+    ASSERT_EQ(window.aggregate(), "hijk");
+
+    window.clear();
+    ASSERT_TRUE(window.empty());
+    ASSERT_THROW(window.aggregate(), std::out_of_range);
+    window.push_back("z");
+    ASSERT_EQ(window.aggregate(), "z");
+}
@@ -0,0 +1,125 @@
+#include <time_series_unrolled_list.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Sample {
+    std::int64_t time;
+    std::string label;
+};
+
+struct SampleTime {
+    std::int64_t operator()(const Sample& sample) const { return sample.time; }
+};
+
+std::vector<std::int64_t> Times(
+    const time_series_unrolled_list<Sample, 4, SampleTime>& series) {
+    std::vector<std::int64_t> times;
+    for (const Sample& sample : series) {
+        times.push_back(sample.time);
+    }
+    return times;
+}
+
+}  // namespace
+
+TEST(TimeSeriesUnrolledList, seekOrdered) {
+    time_series_unrolled_list<int, 4> series;
+    for (int i = 0; i < 100; ++i) {
+        series.push_back(i * 10);
+    }
+    ASSERT_EQ(series.node_count(), 25);
+
+    for (int t = -5; t <= 1000; t += 5) {
+        auto it = series.seek(t);
+        int expected = (t + 9) / 10 * 10;
+        if (t < 0) expected = 0;
+        if (expected > 990) {
+            ASSERT_EQ(it, series.end());
+        } else {
+            ASSERT_EQ(*it, expected);
+        }
+    }
+}
+
+/*
+    Для неупорядоченных меток seek возвращает первый по порядку элемент,
+    метка которого не меньше заданной, и совпадает с std::find_if
+*/
+TEST(TimeSeriesUnrolledList, seekUnordered) {
+    time_series_unrolled_list<int, 4> series;
+    std::list<int> expected;
+    std::mt19937 gen(5);
+    for (int i = 0; i < 200; ++i) {
+        int time = i + static_cast<int>(gen() % 20);
+        series.push_back(time);
+        expected.push_back(time);
+    }
+    for (int t = 0; t < 240; ++t) {
+        auto expected_it = std::find_if(expected.begin(), expected.end(),
+                                        [t](int time) { return time >= t; });
+        auto it = series.seek(t);
+        ASSERT_EQ(std::distance(series.begin(), it),
+                  std::distance(expected.begin(), expected_it));
+    }
+}
+
+/*
+    expire_before целиком освобождает головные ноды, все метки которых
+    старше границы, и подрезает только одну граничную ноду
+*/
+TEST(TimeSeriesUnrolledList, expireBefore) {
+    time_series_unrolled_list<Sample, 4, SampleTime> series;
+    for (int i = 0; i < 30; ++i) {
+        series.push_back({i, std::to_string(i)});
+    }
+    ASSERT_EQ(series.node_count(), 8);
+
+    ASSERT_EQ(series.expire_before(9), 9);
+    ASSERT_EQ(series.node_count(), 6);
+    ASSERT_EQ(series.front().time, 9);
+    ASSERT_EQ(series.front().label, "9");
+    ASSERT_EQ(series.size(), 21);
+
+    ASSERT_EQ(series.expire_before(5), 0);
+    ASSERT_EQ(series.expire_before(12), 3);
+    ASSERT_EQ(series.seek(0)->time, 12);
+
+    series.push_back({40, "40"});
+    ASSERT_EQ(series.expire_before(100), 19);
+    ASSERT_TRUE(series.empty());
+    ASSERT_EQ(series.node_count(), 0);
+    ASSERT_EQ(series.seek(0), series.end());
+
+    series.push_back({50, "50"});
+    ASSERT_THAT(Times(series), ::testing::ElementsAre(50));
+}
+
+/*
+    Граница ноды берётся по максимуму меток, поэтому нода с поздней меткой
+    не освобождается, а удаляется только префикс старых элементов
+*/
+TEST(TimeSeriesUnrolledList, expireKeepsLateSamples) {
+    time_series_unrolled_list<Sample, 4, SampleTime> series;
+    for (std::int64_t time : {1, 2, 3, 4, 5, 20, 6, 7, 8, 9}) {
+        series.push_back({time, ""});
+    }
+    ASSERT_FALSE(series.is_ordered());
+    ASSERT_EQ(series.expire_before(8), 5);
+    ASSERT_THAT(Times(series), ::testing::ElementsAre(20, 6, 7, 8, 9));
+    ASSERT_EQ(series.seek(10)->time, 20);
+    ASSERT_EQ(series.seek(9)->time, 20);
+
+    ASSERT_EQ(series.expire_before(21), 5);
+    ASSERT_TRUE(series.empty());
+    ASSERT_TRUE(series.is_ordered());
+}
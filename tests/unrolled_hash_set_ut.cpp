@@ -0,0 +1,175 @@
+#include <unrolled_hash_set.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct CollidingHash {
+    size_t operator()(int value) const { return value % 3; }
+};
+
+struct IdentityHash {
+    size_t operator()(long long value) const {
+        return static_cast<size_t>(value);
+    }
+};
+
+struct CountingEqual {
+    static inline int Calls = 0;
+    bool operator()(int lhs, int rhs) const {
+        ++Calls;
+        return lhs == rhs;
+    }
+};
+
+struct ThrowingMove {
+    static inline int Alive = 0;
+    static inline int MovesLeft = -1;
+
+    explicit ThrowingMove(int value) : value(value) { ++Alive; }
+    ThrowingMove(const ThrowingMove& other) : value(other.value) { ++Alive; }
+    ThrowingMove(ThrowingMove&& other) : value(other.value) {
+        if (MovesLeft >= 0 && MovesLeft-- == 0) {
+            throw std::runtime_error("move failed");
+        }
+        ++Alive;
+    }
+    ~ThrowingMove() { --Alive; }
+
+    bool operator==(const ThrowingMove& other) const {
+        return value == other.value;
+    }
+
+    int value;
+};
+
+struct ThrowingMoveHash {
+    size_t operator()(const ThrowingMove& key) const { return key.value; }
+};
+
+}  // namespace
+
+TEST(UnrolledHashSet, randomOperationsMatchStdSet) {
+    unrolled_hash_set<int, 8> set;
+    std::unordered_set<int> std_set;
+    std::mt19937 gen(5);
+
+    for (int step = 0; step < 20000; ++step) {
+        int key = static_cast<int>(gen() % 2000);
+        if (gen() % 3 == 0) {
+            ASSERT_EQ(set.erase(key), std_set.erase(key));
+        } else {
+            auto [it, inserted] = set.insert(key);
+            ASSERT_EQ(inserted, std_set.insert(key).second);
+            ASSERT_EQ(*it, key);
+        }
+        ASSERT_EQ(set.size(), std_set.size());
+    }
+
+    for (int key = 0; key < 2000; ++key) {
+        ASSERT_EQ(set.contains(key), std_set.contains(key));
+    }
+    std::vector<int> values(set.begin(), set.end());
+    std::vector<int> expected(std_set.begin(), std_set.end());
+    std::sort(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(values, expected);
+    ASSERT_LE(set.load_factor(), set.max_load_factor());
+}
+
+/*
+    Все ключи попадают в несколько корзин, поэтому цепочки состоят
+    из многих нод и поиск проверяет отпечатки в каждой из них
+*/
+TEST(UnrolledHashSet, longChains) {
+    unrolled_hash_set<int, 16, CollidingHash> set;
+    for (int i = 0; i < 300; ++i) {
+        ASSERT_TRUE(set.insert(i).second);
+    }
+    ASSERT_FALSE(set.insert(17).second);
+    for (int i = 0; i < 300; ++i) {
+        ASSERT_TRUE(set.contains(i));
+    }
+    ASSERT_FALSE(set.contains(300));
+
+    for (int i = 0; i < 300; i += 2) {
+        ASSERT_EQ(set.erase(i), 1);
+    }
+    for (int i = 0; i < 300; ++i) {
+        ASSERT_EQ(set.contains(i), i % 2 == 1);
+    }
+    ASSERT_EQ(set.size(), 150);
+}
+
+TEST(UnrolledHashSet, strings) {
+    unrolled_hash_set<std::string> set = {"a", "b", "c"};
+    set.emplace(5, 'x');
+    ASSERT_TRUE(set.contains("xxxxx"));
+    ASSERT_EQ(set.count("b"), 1);
+    ASSERT_EQ(set.size(), 4);
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+    ASSERT_EQ(set.node_count(), 0);
+}
+
+/*
+    Для целых std::hash -- тождественная функция, поэтому отпечаток должен
+    перемешивать хеш: иначе все маленькие ключи получают один отпечаток
+    и поиск сравнивает ключ со всей цепочкой
+*/
+TEST(UnrolledHashSet, fingerprintsFilterSmallIntegers) {
+    unrolled_hash_set<int, 16, std::hash<int>, CountingEqual> set;
+    for (int i = 0; i < 10000; ++i) {
+        set.insert(i);
+    }
+
+    CountingEqual::Calls = 0;
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(set.contains(i));
+    }
+    ASSERT_LT(CountingEqual::Calls, 11000);
+}
+
+/*
+    Ключи с общими младшими битами тоже расходятся по корзинам: корзина
+    выбирается по перемешанному хешу, а не по младшим битам ключа
+*/
+TEST(UnrolledHashSet, stridedKeysSpreadOverBuckets) {
+    unrolled_hash_set<long long, 16, IdentityHash> set;
+    for (long long i = 0; i < 2000; ++i) {
+        set.insert(i << 20);
+    }
+    ASSERT_EQ(set.size(), 2000);
+    ASSERT_GT(set.node_count(), set.bucket_count() / 2);
+    for (long long i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(set.contains(i << 20));
+    }
+}
+
+TEST(UnrolledHashSet, rehashFailureKeepsSetConsistent) {
+    {
+        unrolled_hash_set<ThrowingMove, 4, ThrowingMoveHash> set;
+        for (int i = 0; i < 32; ++i) {
+            set.emplace(i);
+        }
+        ThrowingMove::MovesLeft = 5;
+        ASSERT_ANY_THROW(set.emplace(32));
+        ThrowingMove::MovesLeft = -1;
+
+        ASSERT_EQ(static_cast<size_t>(std::distance(set.begin(), set.end())),
+                  set.size());
+        ASSERT_EQ(ThrowingMove::Alive, static_cast<int>(set.size()));
+        for (const ThrowingMove& key : set) {
+            ASSERT_TRUE(set.contains(key));
+        }
+    }
+    ASSERT_EQ(ThrowingMove::Alive, 0);
+}
@@ -0,0 +1,86 @@
+#include <unrolled_list_columns.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Trade {
+    std::int64_t time;
+    double price;
+    int volume;
+};
+
+}  // namespace
+
+TEST(UnrolledListColumns, exportAndImportPrimitive) {
+    unrolled_list<double, 4> list;
+    std::vector<double> expected;
+    for (int i = 0; i < 21; ++i) {
+        list.push_back(i * 0.5);
+        expected.push_back(i * 0.5);
+    }
+
+    auto column = export_column(list);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(column.data()) %
+                  aligned_column<double>::alignment,
+              0);
+    ASSERT_THAT(column.span(), ::testing::ElementsAreArray(expected));
+
+    unrolled_list<double, 4> imported(column.span());
+    ASSERT_EQ(imported, list);
+}
+
+TEST(UnrolledListColumns, exportStructFields) {
+    unrolled_list<Trade, 4> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back({i, i * 1.5, i * 10});
+    }
+
+    auto times = export_column(list, &Trade::time);
+    auto volumes = export_column(list, &Trade::volume);
+    ASSERT_EQ(times.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(times[i], i);
+        ASSERT_EQ(volumes[i], i * 10);
+    }
+
+    std::vector<double> prices(10, 2.0);
+    import_column(list, &Trade::price, std::span<const double>(prices));
+    for (const Trade& trade : list) {
+        ASSERT_EQ(trade.price, 2.0);
+    }
+    ASSERT_THROW(import_column(list, &Trade::price,
+                              std::span<const double>(prices).first(3)),
+                 std::length_error);
+}
+
+/*
+    export_chunks не копирует данные: каждый чанк указывает
+    на элементы соответствующей ноды списка
+*/
+TEST(UnrolledListColumns, chunksAreZeroCopy) {
+    std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    unrolled_list<int, 4> list(values);
+
+    auto chunks = export_chunks(list);
+    ASSERT_EQ(chunks.size(), 3);
+    ASSERT_EQ(chunks[0].data(), &list.front());
+    ASSERT_EQ(chunks.back().data() + chunks.back().size() - 1, &list.back());
+
+    std::vector<int> flattened;
+    for (auto chunk : chunks) {
+        flattened.insert(flattened.end(), chunk.begin(), chunk.end());
+    }
+    ASSERT_EQ(flattened, list.to_vector());
+}
+
+TEST(UnrolledListColumns, emptyList) {
+    unrolled_list<int, 4> list;
+    auto column = export_column(list);
+    ASSERT_TRUE(column.empty());
+    ASSERT_TRUE(export_chunks(list).empty());
+}
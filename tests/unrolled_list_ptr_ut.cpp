@@ -0,0 +1,72 @@
+#include <unrolled_list_ptr.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <vector>
+
+/*
+    unrolled_list_ptr в пустом состоянии -- это один нулевой указатель.
+    Заголовок списка создаётся на первой вставке и освобождается, когда список опустел
+*/
+
+static_assert(sizeof(unrolled_list_ptr<int>) == sizeof(void*));
+
+TEST(UnrolledListPtr, emptyHasNoHeader) {
+    unrolled_list_ptr<int, 4> list;
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0);
+    ASSERT_EQ(list.get(), nullptr);
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_EQ(list.rbegin(), list.rend());
+
+    list.push_back(1);
+    ASSERT_NE(list.get(), nullptr);
+
+    list.pop_back();
+    ASSERT_EQ(list.get(), nullptr);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(UnrolledListPtr, behavesLikeList) {
+    std::list<int> std_list;
+    unrolled_list_ptr<int, 4> list;
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 2 == 0) {
+            std_list.push_back(i);
+            list.push_back(i);
+        } else {
+            std_list.push_front(i);
+            list.push_front(i);
+        }
+    }
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_list));
+    ASSERT_EQ(list.front(), std_list.front());
+    ASSERT_EQ(list.back(), std_list.back());
+
+    unrolled_list_ptr<int, 4> copy = list;
+    ASSERT_EQ(copy, list);
+
+    copy.erase(copy.begin(), copy.end());
+    ASSERT_EQ(copy.get(), nullptr);
+    ASSERT_NE(copy, list);
+}
+
+TEST(UnrolledListPtr, manyMostlyEmpty) {
+    std::vector<unrolled_list_ptr<int>> lists(1000);
+    for (size_t i = 0; i < lists.size(); i += 100) {
+        lists[i].insert(lists[i].end(), static_cast<int>(i));
+    }
+
+    size_t non_empty = 0;
+    for (const auto& list : lists) {
+        if (!list.empty()) {
+            ++non_empty;
+            ASSERT_EQ(list.size(), 1);
+        }
+    }
+    ASSERT_EQ(non_empty, 10);
+}